@@ -0,0 +1,419 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  persistent analysis cache sidecar for repeated runs on the same crash dump.
+//=============================================================================
+
+// local.
+#include "rgd_analysis_cache.h"
+#include "rgd_mmap_file.h"
+#include "rgd_utils.h"
+
+// C++.
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+// *** INTERNALLY-LINKED CONSTANTS - BEGIN ***
+
+// Extension of the sidecar file, appended to the crash dump file name.
+static const char* kCacheFileExtension = ".rgdcache";
+
+// Magic bytes identifying a sidecar file.
+static const char kCacheFileMagic[8] = { 'R', 'G', 'D', 'C', 'A', 'C', 'H', 'E' };
+
+// Version of the sidecar format. Bump on any layout change: mismatching
+// versions are treated as a cache miss and the sidecar is rewritten.
+static const uint32_t kCacheFormatVersion = 1;
+
+// *** INTERNALLY-LINKED CONSTANTS - END ***
+
+// *** INTERNALLY-LINKED AUXILIARY TYPES AND FUNCTIONS - BEGIN ***
+
+// Fixed header at the start of the sidecar file. All multi-byte fields are
+// little-endian; sections with the cached structures follow sequentially.
+struct RgdCacheFileHeader
+{
+    char magic[8];
+    uint32_t version;
+
+    // Configuration flags the cached structures depend on (kCacheFlag* bits).
+    uint32_t flags;
+    uint64_t dump_file_hash;
+    uint64_t dump_file_size;
+};
+
+// Set when the command buffer mapping was built with internal barriers included.
+static const uint32_t kCacheFlagIncludeInternalBarriers = 1u << 0;
+
+// Set when the cached events include timestamp tick events (--raw-data runs).
+// A mismatch means the cached event list differs and is treated as a miss.
+static const uint32_t kCacheFlagRawEventData = 1u << 1;
+
+// Bounds-checked sequential reader over the memory-mapped sidecar file.
+// Reads are memcpy-based so the cached structures need no alignment guarantees.
+struct RgdCacheReader
+{
+    RgdCacheReader(const void* data, size_t size) :
+        bytes(static_cast<const uint8_t*>(data)), total_size(size) {}
+
+    bool Read(void* destination, size_t byte_count)
+    {
+        if (is_ok && byte_count <= total_size - offset)
+        {
+            std::memcpy(destination, bytes + offset, byte_count);
+            offset += byte_count;
+        }
+        else
+        {
+            is_ok = false;
+        }
+        return is_ok;
+    }
+
+    template <typename T>
+    bool ReadValue(T& value)
+    {
+        return Read(&value, sizeof(T));
+    }
+
+    const uint8_t* bytes = nullptr;
+    size_t total_size = 0;
+    size_t offset = 0;
+    bool is_ok = true;
+};
+
+// Writes the crash data section (chunk header, time info, payload and event index).
+static void WriteCrashDataSection(std::ofstream& file, const CrashData& crash_data)
+{
+    file.write(reinterpret_cast<const char*>(&crash_data.chunk_header), sizeof(crash_data.chunk_header));
+    file.write(reinterpret_cast<const char*>(&crash_data.time_info), sizeof(crash_data.time_info));
+
+    const uint64_t payload_size = crash_data.chunk_payload.size();
+    file.write(reinterpret_cast<const char*>(&payload_size), sizeof(payload_size));
+    if (payload_size > 0)
+    {
+        file.write(reinterpret_cast<const char*>(crash_data.chunk_payload.data()), payload_size);
+    }
+
+    const uint64_t event_count = crash_data.events.size();
+    file.write(reinterpret_cast<const char*>(&event_count), sizeof(event_count));
+    for (const RgdEventOccurrence& event : crash_data.events)
+    {
+        // Events are stored as offsets into the payload so that the pointers can
+        // be rebuilt against the payload loaded on a subsequent run.
+        const uint64_t event_offset = reinterpret_cast<const uint8_t*>(event.rgd_event) - crash_data.chunk_payload.data();
+        const uint64_t event_time = event.event_time;
+        file.write(reinterpret_cast<const char*>(&event_offset), sizeof(event_offset));
+        file.write(reinterpret_cast<const char*>(&event_time), sizeof(event_time));
+    }
+}
+
+// Returns true when every event of the crash data points into its payload, so
+// the events can be serialized as payload offsets.
+static bool AreEventOffsetsSerializable(const CrashData& crash_data)
+{
+    bool ret = true;
+    const uint8_t* payload_begin = crash_data.chunk_payload.data();
+    const uint8_t* payload_end = payload_begin + crash_data.chunk_payload.size();
+    for (const RgdEventOccurrence& event : crash_data.events)
+    {
+        const uint8_t* event_bytes = reinterpret_cast<const uint8_t*>(event.rgd_event);
+        if (event_bytes < payload_begin || event_bytes >= payload_end)
+        {
+            ret = false;
+            break;
+        }
+    }
+    return ret;
+}
+
+// Reads the crash data section and rebuilds the event pointers into the
+// freshly loaded payload.
+static bool ReadCrashDataSection(RgdCacheReader& reader, CrashData& crash_data)
+{
+    reader.ReadValue(crash_data.chunk_header);
+    reader.ReadValue(crash_data.time_info);
+
+    uint64_t payload_size = 0;
+    if (reader.ReadValue(payload_size) && payload_size <= reader.total_size - reader.offset)
+    {
+        crash_data.chunk_payload.resize(static_cast<size_t>(payload_size));
+        reader.Read(crash_data.chunk_payload.data(), static_cast<size_t>(payload_size));
+    }
+    else
+    {
+        reader.is_ok = false;
+    }
+
+    uint64_t event_count = 0;
+    if (reader.ReadValue(event_count))
+    {
+        // Two uint64 values per event record.
+        const uint64_t kEventRecordSize = 2 * sizeof(uint64_t);
+        if (event_count <= (reader.total_size - reader.offset) / kEventRecordSize)
+        {
+            crash_data.events.reserve(static_cast<size_t>(event_count));
+            for (uint64_t i = 0; reader.is_ok && i < event_count; i++)
+            {
+                uint64_t event_offset = 0;
+                uint64_t event_time = 0;
+                reader.ReadValue(event_offset);
+                reader.ReadValue(event_time);
+                if (reader.is_ok && event_offset < payload_size)
+                {
+                    RgdEvent* rgd_event = reinterpret_cast<RgdEvent*>(crash_data.chunk_payload.data() + event_offset);
+                    crash_data.events.push_back(RgdEventOccurrence(rgd_event, event_time));
+                }
+                else
+                {
+                    reader.is_ok = false;
+                }
+            }
+        }
+        else
+        {
+            reader.is_ok = false;
+        }
+    }
+    return reader.is_ok;
+}
+
+// *** INTERNALLY-LINKED AUXILIARY TYPES AND FUNCTIONS - END ***
+
+RgdAnalysisCache::RgdAnalysisCache(const std::string& crash_dump_file_path) :
+    crash_dump_file_path_(crash_dump_file_path),
+    cache_file_path_(crash_dump_file_path + kCacheFileExtension)
+{
+}
+
+bool RgdAnalysisCache::ComputeFileHash(const std::string& file_path, uint64_t& hash, uint64_t& file_size)
+{
+    bool ret = false;
+
+    // FNV-1a, 64-bit.
+    const uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ull;
+    const uint64_t kFnvPrime = 0x100000001b3ull;
+    hash = kFnvOffsetBasis;
+    file_size = 0;
+
+    RgdMmapFile file_mapping;
+    if (file_mapping.Map(file_path))
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(file_mapping.GetData());
+        file_size = file_mapping.GetSize();
+        for (size_t i = 0; i < file_size; i++)
+        {
+            hash = (hash ^ bytes[i]) * kFnvPrime;
+        }
+        ret = true;
+    }
+    else
+    {
+        // Fall back to buffered reads when the file cannot be memory-mapped.
+        std::ifstream file(file_path, std::ios::binary);
+        if (file.is_open())
+        {
+            char buffer[64 * 1024];
+            while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+            {
+                const std::streamsize bytes_read = file.gcount();
+                for (std::streamsize i = 0; i < bytes_read; i++)
+                {
+                    hash = (hash ^ static_cast<uint8_t>(buffer[i])) * kFnvPrime;
+                }
+                file_size += bytes_read;
+            }
+            ret = true;
+        }
+    }
+    return ret;
+}
+
+bool RgdAnalysisCache::Load(const Config& user_config, RgdCrashDumpContents& contents)
+{
+    const bool is_verbose = user_config.is_verbose;
+    is_cache_hit_ = false;
+    is_cmd_buffer_mapping_loaded_ = false;
+    is_va_interval_index_loaded_ = false;
+
+    if (!is_dump_hashed_)
+    {
+        is_dump_hashed_ = ComputeFileHash(crash_dump_file_path_, dump_file_hash_, dump_file_size_);
+    }
+
+    RgdMmapFile cache_mapping;
+    if (is_dump_hashed_ && cache_mapping.Map(cache_file_path_))
+    {
+        RgdCacheReader reader(cache_mapping.GetData(), cache_mapping.GetSize());
+
+        // Validate the header: magic, format version and the recorded dump hash.
+        RgdCacheFileHeader header{};
+        bool is_valid = reader.ReadValue(header)
+            && std::memcmp(header.magic, kCacheFileMagic, sizeof(kCacheFileMagic)) == 0
+            && header.version == kCacheFormatVersion
+            && header.dump_file_hash == dump_file_hash_
+            && header.dump_file_size == dump_file_size_
+            && (((header.flags & kCacheFlagRawEventData) != 0) == user_config.is_raw_event_data);
+
+        if (is_valid)
+        {
+            is_valid = ReadCrashDataSection(reader, contents.umd_crash_data)
+                && ReadCrashDataSection(reader, contents.kmd_crash_data);
+        }
+
+        if (is_valid)
+        {
+            // Command buffer mapping. The mapping depends on the internal barrier
+            // filtering flag: when the cached flag differs from this run's, the
+            // section is skipped and the caller rebuilds the mapping from the events.
+            const bool is_mapping_usable =
+                ((header.flags & kCacheFlagIncludeInternalBarriers) != 0) == user_config.is_include_internal_barriers;
+            std::unordered_map<uint64_t, std::vector<size_t>> per_cmd_buffer_indices;
+            uint64_t entry_count = 0;
+            reader.ReadValue(entry_count);
+            for (uint64_t i = 0; reader.is_ok && i < entry_count; i++)
+            {
+                uint64_t cmd_buffer_id = 0;
+                uint64_t index_count = 0;
+                reader.ReadValue(cmd_buffer_id);
+                if (reader.ReadValue(index_count) && index_count <= (reader.total_size - reader.offset) / sizeof(uint64_t))
+                {
+                    if (is_mapping_usable)
+                    {
+                        std::vector<size_t>& event_indices = per_cmd_buffer_indices[cmd_buffer_id];
+                        event_indices.reserve(static_cast<size_t>(index_count));
+                        for (uint64_t j = 0; reader.is_ok && j < index_count; j++)
+                        {
+                            uint64_t event_index = 0;
+                            reader.ReadValue(event_index);
+                            event_indices.push_back(static_cast<size_t>(event_index));
+                        }
+                    }
+                    else
+                    {
+                        reader.offset += static_cast<size_t>(index_count) * sizeof(uint64_t);
+                    }
+                }
+                else
+                {
+                    reader.is_ok = false;
+                }
+            }
+            is_valid = reader.is_ok;
+            is_cmd_buffer_mapping_loaded_ = is_valid && is_mapping_usable;
+            if (is_cmd_buffer_mapping_loaded_)
+            {
+                contents.cmd_buffer_mapping.Build(per_cmd_buffer_indices);
+            }
+        }
+
+        if (is_valid)
+        {
+            // Virtual address interval index (optional).
+            uint64_t is_index_present = 0;
+            uint64_t interval_count = 0;
+            reader.ReadValue(is_index_present);
+            if (reader.ReadValue(interval_count) && interval_count <= (reader.total_size - reader.offset) / sizeof(RgdVaInterval))
+            {
+                if (is_index_present != 0)
+                {
+                    va_interval_index_.resize(static_cast<size_t>(interval_count));
+                    reader.Read(va_interval_index_.data(), static_cast<size_t>(interval_count) * sizeof(RgdVaInterval));
+                    is_va_interval_index_loaded_ = reader.is_ok;
+                }
+            }
+            is_valid = reader.is_ok;
+        }
+
+        if (is_valid)
+        {
+            is_cache_hit_ = true;
+            std::stringstream msg;
+            msg << "analysis cache loaded from " << cache_file_path_ << ".";
+            RgdUtils::PrintMessage(msg.str().c_str(), RgdMessageType::kInfo, is_verbose);
+        }
+        else
+        {
+            // A stale or truncated sidecar is not an error: fall back to a full parse.
+            contents.umd_crash_data = CrashData{};
+            contents.kmd_crash_data = CrashData{};
+            contents.cmd_buffer_mapping.Clear();
+            va_interval_index_.clear();
+            is_cmd_buffer_mapping_loaded_ = false;
+            is_va_interval_index_loaded_ = false;
+            RgdUtils::PrintMessage("ignoring stale or invalid analysis cache file.", RgdMessageType::kInfo, is_verbose);
+        }
+    }
+    return is_cache_hit_;
+}
+
+bool RgdAnalysisCache::Save(const Config& user_config, const RgdCrashDumpContents& contents, const std::vector<RgdVaInterval>& va_intervals) const
+{
+    const bool is_verbose = user_config.is_verbose;
+    bool ret = false;
+
+    // Only save when the events can be expressed as payload offsets and the dump hash is known.
+    assert(is_dump_hashed_);
+    if (is_dump_hashed_ && AreEventOffsetsSerializable(contents.umd_crash_data) && AreEventOffsetsSerializable(contents.kmd_crash_data))
+    {
+        std::ofstream file(cache_file_path_, std::ios::binary | std::ios::trunc);
+        if (file.is_open())
+        {
+            RgdCacheFileHeader header{};
+            std::memcpy(header.magic, kCacheFileMagic, sizeof(kCacheFileMagic));
+            header.version = kCacheFormatVersion;
+            header.flags = (user_config.is_include_internal_barriers ? kCacheFlagIncludeInternalBarriers : 0)
+                | (user_config.is_raw_event_data ? kCacheFlagRawEventData : 0);
+            header.dump_file_hash = dump_file_hash_;
+            header.dump_file_size = dump_file_size_;
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            WriteCrashDataSection(file, contents.umd_crash_data);
+            WriteCrashDataSection(file, contents.kmd_crash_data);
+
+            // Command buffer mapping. The ranges are iterated in command buffer ID
+            // order, so the cached section is deterministic across runs.
+            const uint64_t entry_count = contents.cmd_buffer_mapping.GetCmdBufferCount();
+            file.write(reinterpret_cast<const char*>(&entry_count), sizeof(entry_count));
+            for (const RgdCmdBufferMapping::Range& mapping_range : contents.cmd_buffer_mapping.GetRanges())
+            {
+                const uint64_t cmd_buffer_id = mapping_range.cmd_buffer_id;
+                const uint64_t index_count = mapping_range.count;
+                file.write(reinterpret_cast<const char*>(&cmd_buffer_id), sizeof(cmd_buffer_id));
+                file.write(reinterpret_cast<const char*>(&index_count), sizeof(index_count));
+                for (const size_t event_index : contents.cmd_buffer_mapping.GetSpan(mapping_range))
+                {
+                    const uint64_t event_index64 = event_index;
+                    file.write(reinterpret_cast<const char*>(&event_index64), sizeof(event_index64));
+                }
+            }
+
+            // Virtual address interval index (optional).
+            const uint64_t is_index_present = va_intervals.empty() ? 0 : 1;
+            const uint64_t interval_count = va_intervals.size();
+            file.write(reinterpret_cast<const char*>(&is_index_present), sizeof(is_index_present));
+            file.write(reinterpret_cast<const char*>(&interval_count), sizeof(interval_count));
+            if (interval_count > 0)
+            {
+                file.write(reinterpret_cast<const char*>(va_intervals.data()), interval_count * sizeof(RgdVaInterval));
+            }
+
+            ret = file.good();
+            if (ret)
+            {
+                std::stringstream msg;
+                msg << "analysis cache written to " << cache_file_path_ << ".";
+                RgdUtils::PrintMessage(msg.str().c_str(), RgdMessageType::kInfo, is_verbose);
+            }
+        }
+
+        if (!ret)
+        {
+            RgdUtils::PrintMessage("could not write the analysis cache file.", RgdMessageType::kInfo, is_verbose);
+        }
+    }
+    return ret;
+}
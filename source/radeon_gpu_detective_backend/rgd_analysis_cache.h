@@ -0,0 +1,78 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  persistent analysis cache sidecar for repeated runs on the same crash dump.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_ANALYSIS_CACHE_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_ANALYSIS_CACHE_H_
+
+// C++.
+#include <string>
+#include <vector>
+
+// Local.
+#include "rgd_data_types.h"
+#include "rgd_resource_info_serializer.h"
+
+// Versioned binary sidecar ("<dump>.rgdcache") holding the parsed crash data
+// events, the command buffer mapping and the virtual address interval index.
+// When a subsequent run finds a sidecar whose recorded hash matches the crash
+// dump, the expensive parsing and history passes are skipped and the cached
+// structures are loaded with a memory-mapped, mostly sequential read.
+class RgdAnalysisCache
+{
+public:
+    explicit RgdAnalysisCache(const std::string& crash_dump_file_path);
+
+    // Attempts to load the sidecar next to the crash dump. Returns true when the
+    // sidecar exists, matches the dump's hash and size, and was restored into
+    // contents (crash data events and command buffer mapping).
+    bool Load(const Config& user_config, RgdCrashDumpContents& contents);
+
+    // Writes the sidecar next to the crash dump. va_intervals may be empty when
+    // the run did not build the virtual address interval index.
+    bool Save(const Config& user_config, const RgdCrashDumpContents& contents, const std::vector<RgdVaInterval>& va_intervals) const;
+
+    // Returns true when Load() succeeded for this crash dump.
+    bool IsCacheHit() const { return is_cache_hit_; }
+
+    // Returns true when the cached command buffer mapping was restored. The
+    // mapping depends on the internal barrier filtering flag; when the cached
+    // flag differs from this run's, the mapping must be rebuilt from the events.
+    bool IsCmdBufferMappingLoaded() const { return is_cmd_buffer_mapping_loaded_; }
+
+    // Returns true when the loaded sidecar carried a virtual address interval index.
+    bool HasVaIntervalIndex() const { return is_va_interval_index_loaded_; }
+
+    // Returns the loaded virtual address interval index (valid after a cache hit
+    // when HasVaIntervalIndex() is true). The vector may be moved out by the caller.
+    std::vector<RgdVaInterval>& GetVaIntervalIndex() { return va_interval_index_; }
+
+private:
+    // Computes the FNV-1a hash of the crash dump file contents, along with its size.
+    static bool ComputeFileHash(const std::string& file_path, uint64_t& hash, uint64_t& file_size);
+
+    // Full path to the crash dump input file.
+    std::string crash_dump_file_path_;
+
+    // Full path to the sidecar file ("<dump>.rgdcache").
+    std::string cache_file_path_;
+
+    // Hash and size of the crash dump, computed on first use.
+    uint64_t dump_file_hash_ = 0;
+    uint64_t dump_file_size_ = 0;
+    bool is_dump_hashed_ = false;
+
+    // True when the sidecar was loaded successfully for this crash dump.
+    bool is_cache_hit_ = false;
+
+    // True when the cached command buffer mapping matches this run's configuration.
+    bool is_cmd_buffer_mapping_loaded_ = false;
+
+    // Virtual address interval index restored from the sidecar.
+    std::vector<RgdVaInterval> va_interval_index_;
+    bool is_va_interval_index_loaded_ = false;
+};
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_ANALYSIS_CACHE_H_
@@ -0,0 +1,371 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  stable C API for in-process crash dump analysis.
+//=============================================================================
+#include "rgd_capi.h"
+
+// C++.
+#include <cassert>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Local.
+#include "rgd_data_types.h"
+#include "rgd_parsing_utils.h"
+#include "rgd_marker_data_serializer.h"
+#include "rgd_resource_info_serializer.h"
+#include "rgd_utils.h"
+
+// RDF.
+#include "rdf/rdf/inc/amdrdf.h"
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS - BEGIN ***
+
+// Section names pumped through RgdSectionCallback.
+static const char* kSectionMarkersInProgress = "markers_in_progress";
+static const char* kSectionExecutionMarkerTree = "execution_marker_tree";
+static const char* kSectionPageFaultSummary = "page_fault_summary";
+
+// Identifier of the crash data chunk in the crash dump file.
+static const char* kChunkIdCrashData = "DDEvent";
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS - ENDS ***
+
+// The analysis state behind an RgdAnalysisHandle. Owns the parsed dump contents
+// and every string handed out through the accessors, so returned pointers stay
+// valid until rgd_analysis_destroy.
+struct RgdAnalysis_t
+{
+    Config user_config;
+    RgdCrashDumpContents contents;
+    ExecMarkerDataSerializer exec_marker_serializer;
+    RgdResourceInfoSerializer resource_serializer;
+
+    // Indices into contents.kmd_crash_data.events of the page fault events.
+    std::vector<size_t> page_fault_event_indices;
+
+    // Lazily generated, memoized outputs.
+    std::string marker_summary;
+    bool is_marker_summary_generated = false;
+    std::string marker_tree;
+    bool is_marker_tree_generated = false;
+    std::vector<std::string> page_fault_summaries;
+    std::vector<bool> is_page_fault_summary_generated;
+
+    bool is_marker_tree_requested = false;
+    bool is_resource_history_requested = false;
+};
+
+// *** INTERNALLY-LINKED AUXILIARY FUNCTIONS - BEGIN ***
+
+// Validates the caller-provided options struct and applies it to the analysis.
+// A null options pointer selects the defaults.
+static bool ApplyOptions(const RgdAnalyzeOptions* options, RgdAnalysis_t& analysis)
+{
+    bool ret = true;
+    if (options != nullptr)
+    {
+        // All v1.0 fields are part of the baseline struct, so a smaller
+        // struct_size is malformed: reading the option fields regardless would
+        // run past the end of the caller-provided struct. Fields appended by
+        // future versions must instead be gated individually on
+        // struct_size >= offsetof(RgdAnalyzeOptions, field) + sizeof(field).
+        ret = (options->struct_size >= sizeof(RgdAnalyzeOptions));
+        if (ret)
+        {
+            analysis.is_marker_tree_requested = (options->include_marker_tree != 0);
+            analysis.is_resource_history_requested = (options->include_resource_history != 0);
+            analysis.user_config.is_include_internal_barriers = (options->include_internal_barriers != 0);
+        }
+    }
+    else
+    {
+        // Defaults match the CLI: full marker tree and resource history.
+        analysis.is_marker_tree_requested = true;
+        analysis.is_resource_history_requested = true;
+    }
+    return ret;
+}
+
+// Parses the crash dump into the analysis state. Returns false on parse failure.
+static bool ParseDumpForAnalysis(const char* crash_dump_path, RgdAnalysis_t& analysis)
+{
+    bool ret = false;
+    try
+    {
+        analysis.user_config.crash_dump_file = crash_dump_path;
+
+        auto file = rdf::Stream::OpenFile(crash_dump_path);
+        rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
+
+        std::string error_msg;
+        ret = RgdParsingUtils::ParseCrashDataChunks(chunk_file, kChunkIdCrashData, analysis.contents.umd_crash_data,
+            analysis.contents.kmd_crash_data, error_msg, analysis.user_config.is_raw_event_data);
+
+        if (ret)
+        {
+            ret = RgdParsingUtils::BuildCommandBufferMapping(analysis.user_config, analysis.contents.umd_crash_data,
+                analysis.contents.cmd_buffer_mapping);
+        }
+
+        // The crashing process information is optional in older captures.
+        RgdParsingUtils::ParseTraceProcessInfoChunk(chunk_file, kChunkIdTraceProcessInfo, analysis.contents.crashing_app_process_info);
+        file.Close();
+    }
+    catch (...)
+    {
+        ret = false;
+    }
+
+    if (ret)
+    {
+        // Collect the page fault events. The RMT data set load is deferred until
+        // the first resource history query, so handles that never query it
+        // (or analyses without resource history) skip it entirely.
+        analysis.resource_serializer.InitializeWithTraceFile(analysis.user_config.crash_dump_file);
+        const std::vector<RgdEventOccurrence>& kmd_events = analysis.contents.kmd_crash_data.events;
+        for (size_t i = 0; i < kmd_events.size(); ++i)
+        {
+            if (kmd_events[i].rgd_event != nullptr &&
+                kmd_events[i].rgd_event->header.eventId == uint8_t(KmdEventId::RgdEventVmPageFault))
+            {
+                analysis.page_fault_event_indices.push_back(i);
+            }
+        }
+        analysis.page_fault_summaries.resize(analysis.page_fault_event_indices.size());
+        analysis.is_page_fault_summary_generated.resize(analysis.page_fault_event_indices.size(), false);
+    }
+    return ret;
+}
+
+// Generates and memoizes the markers-in-progress summary.
+static bool EnsureMarkerSummary(RgdAnalysis_t& analysis)
+{
+    if (!analysis.is_marker_summary_generated)
+    {
+        analysis.is_marker_summary_generated = analysis.exec_marker_serializer.GenerateExecutionMarkerSummaryList(
+            analysis.user_config, analysis.contents.umd_crash_data, analysis.contents.cmd_buffer_mapping, analysis.marker_summary);
+    }
+    return analysis.is_marker_summary_generated;
+}
+
+// Generates and memoizes the execution marker tree.
+static bool EnsureMarkerTree(RgdAnalysis_t& analysis)
+{
+    if (!analysis.is_marker_tree_generated && analysis.is_marker_tree_requested)
+    {
+        analysis.is_marker_tree_generated = analysis.exec_marker_serializer.GenerateExecutionMarkerTree(
+            analysis.user_config, analysis.contents.umd_crash_data, analysis.contents.cmd_buffer_mapping, analysis.marker_tree);
+    }
+    return analysis.is_marker_tree_generated;
+}
+
+// Generates and memoizes the resource history text for one page fault event.
+static bool EnsurePageFaultSummary(RgdAnalysis_t& analysis, size_t index)
+{
+    bool ret = false;
+    if (analysis.is_page_fault_summary_generated[index])
+    {
+        ret = true;
+    }
+    else if (analysis.is_resource_history_requested)
+    {
+        const RgdEventOccurrence& page_fault_event =
+            analysis.contents.kmd_crash_data.events[analysis.page_fault_event_indices[index]];
+        const VmPageFaultEvent& curr_event = static_cast<const VmPageFaultEvent&>(*page_fault_event.rgd_event);
+        if (curr_event.faultVmAddress != kVaReserved)
+        {
+            ret = analysis.resource_serializer.GetVirtualAddressHistoryInfo(analysis.user_config,
+                curr_event.faultVmAddress, analysis.page_fault_summaries[index]);
+        }
+        else
+        {
+            analysis.page_fault_summaries[index] = "INFO: no resources associated with virtual address 0x0.";
+            ret = true;
+        }
+        analysis.is_page_fault_summary_generated[index] = ret;
+    }
+    return ret;
+}
+
+// *** INTERNALLY-LINKED AUXILIARY FUNCTIONS - END ***
+
+RgdCApiResult rgd_capi_get_version(uint32_t* out_major, uint32_t* out_minor)
+{
+    if (out_major == nullptr || out_minor == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    *out_major = RGD_CAPI_VERSION_MAJOR;
+    *out_minor = RGD_CAPI_VERSION_MINOR;
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analysis_create(const char* crash_dump_path, const RgdAnalyzeOptions* options, RgdAnalysisHandle* out_handle)
+{
+    if (crash_dump_path == nullptr || out_handle == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    *out_handle = nullptr;
+
+    auto analysis = std::make_unique<RgdAnalysis_t>();
+    if (!ApplyOptions(options, *analysis))
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    if (!ParseDumpForAnalysis(crash_dump_path, *analysis))
+    {
+        return RGD_CAPI_ERROR_PARSE_FAILED;
+    }
+    *out_handle = analysis.release();
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analysis_destroy(RgdAnalysisHandle handle)
+{
+    if (handle == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    delete handle;
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analysis_get_marker_summary(RgdAnalysisHandle handle, const char** out_text)
+{
+    if (handle == nullptr || out_text == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    if (!EnsureMarkerSummary(*handle))
+    {
+        return RGD_CAPI_ERROR_ANALYSIS_FAILED;
+    }
+    *out_text = handle->marker_summary.c_str();
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analysis_get_marker_tree(RgdAnalysisHandle handle, const char** out_text)
+{
+    if (handle == nullptr || out_text == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    if (!EnsureMarkerTree(*handle))
+    {
+        return RGD_CAPI_ERROR_ANALYSIS_FAILED;
+    }
+    *out_text = handle->marker_tree.c_str();
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analysis_get_page_fault_count(RgdAnalysisHandle handle, uint64_t* out_count)
+{
+    if (handle == nullptr || out_count == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    *out_count = handle->page_fault_event_indices.size();
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analysis_get_page_fault_va(RgdAnalysisHandle handle, uint64_t index, uint64_t* out_va)
+{
+    if (handle == nullptr || out_va == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    if (index >= handle->page_fault_event_indices.size())
+    {
+        return RGD_CAPI_ERROR_OUT_OF_RANGE;
+    }
+    const RgdEventOccurrence& page_fault_event =
+        handle->contents.kmd_crash_data.events[handle->page_fault_event_indices[size_t(index)]];
+    *out_va = static_cast<const VmPageFaultEvent&>(*page_fault_event.rgd_event).faultVmAddress;
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analysis_get_page_fault_summary(RgdAnalysisHandle handle, uint64_t index, const char** out_text)
+{
+    if (handle == nullptr || out_text == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    if (index >= handle->page_fault_event_indices.size())
+    {
+        return RGD_CAPI_ERROR_OUT_OF_RANGE;
+    }
+    if (!EnsurePageFaultSummary(*handle, size_t(index)))
+    {
+        return RGD_CAPI_ERROR_ANALYSIS_FAILED;
+    }
+    *out_text = handle->page_fault_summaries[size_t(index)].c_str();
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analysis_get_crashing_process_id(RgdAnalysisHandle handle, uint32_t* out_process_id)
+{
+    if (handle == nullptr || out_process_id == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    *out_process_id = handle->contents.crashing_app_process_info.process_id;
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analysis_get_crashing_process_path(RgdAnalysisHandle handle, const char** out_path)
+{
+    if (handle == nullptr || out_path == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+    *out_path = handle->contents.crashing_app_process_info.process_path.c_str();
+    return RGD_CAPI_OK;
+}
+
+RgdCApiResult rgd_analyze(const char* crash_dump_path, const RgdAnalyzeOptions* options, RgdSectionCallback on_section, void* user_data)
+{
+    if (on_section == nullptr)
+    {
+        return RGD_CAPI_ERROR_INVALID_ARGUMENT;
+    }
+
+    RgdAnalysisHandle handle = nullptr;
+    RgdCApiResult result = rgd_analysis_create(crash_dump_path, options, &handle);
+    if (result == RGD_CAPI_OK)
+    {
+        const char* text = nullptr;
+        result = rgd_analysis_get_marker_summary(handle, &text);
+        if (result == RGD_CAPI_OK)
+        {
+            on_section(kSectionMarkersInProgress, text, user_data);
+        }
+
+        if (result == RGD_CAPI_OK && handle->is_marker_tree_requested)
+        {
+            result = rgd_analysis_get_marker_tree(handle, &text);
+            if (result == RGD_CAPI_OK)
+            {
+                on_section(kSectionExecutionMarkerTree, text, user_data);
+            }
+        }
+
+        if (result == RGD_CAPI_OK && handle->is_resource_history_requested)
+        {
+            for (uint64_t i = 0; result == RGD_CAPI_OK && i < handle->page_fault_event_indices.size(); ++i)
+            {
+                result = rgd_analysis_get_page_fault_summary(handle, i, &text);
+                if (result == RGD_CAPI_OK)
+                {
+                    on_section(kSectionPageFaultSummary, text, user_data);
+                }
+            }
+        }
+        rgd_analysis_destroy(handle);
+    }
+    return result;
+}
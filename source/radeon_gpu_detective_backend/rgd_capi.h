@@ -0,0 +1,127 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  stable C API for in-process crash dump analysis.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_CAPI_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_CAPI_H_
+
+#include <stdint.h>
+
+// Export macro for the shared library build. Consumers of the static library
+// link the symbols directly.
+#ifdef _WIN32
+#ifdef RGD_CAPI_BUILD_SHARED
+#define RGD_CAPI_API __declspec(dllexport)
+#else
+#define RGD_CAPI_API
+#endif
+#else
+#define RGD_CAPI_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The API version. The major version is incremented on breaking changes only;
+// new fields are appended to RgdAnalyzeOptions and guarded by struct_size.
+#define RGD_CAPI_VERSION_MAJOR 1
+#define RGD_CAPI_VERSION_MINOR 0
+
+// Result codes returned by every API entry point.
+typedef enum RgdCApiResult
+{
+    RGD_CAPI_OK = 0,
+
+    // A null handle or argument, or a malformed options struct.
+    RGD_CAPI_ERROR_INVALID_ARGUMENT = 1,
+
+    // The crash dump file could not be opened or parsed.
+    RGD_CAPI_ERROR_PARSE_FAILED = 2,
+
+    // An index argument is out of range.
+    RGD_CAPI_ERROR_OUT_OF_RANGE = 3,
+
+    // The requested information could not be generated.
+    RGD_CAPI_ERROR_ANALYSIS_FAILED = 4
+} RgdCApiResult;
+
+// Analysis options. Zero-initialize and set struct_size to
+// sizeof(RgdAnalyzeOptions) so that fields appended by newer library versions
+// keep their defaults for older callers.
+typedef struct RgdAnalyzeOptions
+{
+    // Must be set to sizeof(RgdAnalyzeOptions) by the caller.
+    uint32_t struct_size;
+
+    // Non-zero to generate the execution marker tree section; zero restricts
+    // the analysis to the markers-in-progress summary (faster).
+    int32_t include_marker_tree;
+
+    // Non-zero to include resource history for faulting virtual addresses.
+    // Requires loading the memory trace data set, which dominates analysis
+    // time on large dumps.
+    int32_t include_resource_history;
+
+    // Non-zero to include internal driver barriers in the execution marker tree.
+    int32_t include_internal_barriers;
+} RgdAnalyzeOptions;
+
+// Receives one named output section. The strings are owned by the library and
+// are only valid for the duration of the call.
+typedef void (*RgdSectionCallback)(const char* section_name, const char* contents, void* user_data);
+
+// Opaque handle to a parsed crash dump analysis.
+typedef struct RgdAnalysis_t* RgdAnalysisHandle;
+
+// Returns the API version of the library the caller is linked against.
+RGD_CAPI_API RgdCApiResult rgd_capi_get_version(uint32_t* out_major, uint32_t* out_minor);
+
+// Parses the crash dump at crash_dump_path and returns a handle for querying
+// results. options may be null for defaults. The handle owns all returned
+// strings; they stay valid until rgd_analysis_destroy.
+RGD_CAPI_API RgdCApiResult rgd_analysis_create(const char* crash_dump_path,
+                                               const RgdAnalyzeOptions* options,
+                                               RgdAnalysisHandle* out_handle);
+
+// Releases the analysis and all strings it returned.
+RGD_CAPI_API RgdCApiResult rgd_analysis_destroy(RgdAnalysisHandle handle);
+
+// Returns the textual markers-in-progress summary.
+RGD_CAPI_API RgdCApiResult rgd_analysis_get_marker_summary(RgdAnalysisHandle handle, const char** out_text);
+
+// Returns the textual execution marker tree. Fails when the analysis was
+// created with include_marker_tree set to zero.
+RGD_CAPI_API RgdCApiResult rgd_analysis_get_marker_tree(RgdAnalysisHandle handle, const char** out_text);
+
+// Returns the number of page fault events in the dump.
+RGD_CAPI_API RgdCApiResult rgd_analysis_get_page_fault_count(RgdAnalysisHandle handle, uint64_t* out_count);
+
+// Returns the faulting virtual address of the page fault at the given index.
+RGD_CAPI_API RgdCApiResult rgd_analysis_get_page_fault_va(RgdAnalysisHandle handle, uint64_t index, uint64_t* out_va);
+
+// Returns the textual resource history for the page fault at the given index.
+// Fails when the analysis was created with include_resource_history set to zero.
+RGD_CAPI_API RgdCApiResult rgd_analysis_get_page_fault_summary(RgdAnalysisHandle handle, uint64_t index, const char** out_text);
+
+// Returns the process id of the crashing application (zero when unavailable).
+RGD_CAPI_API RgdCApiResult rgd_analysis_get_crashing_process_id(RgdAnalysisHandle handle, uint32_t* out_process_id);
+
+// Returns the executable path of the crashing application (empty when unavailable).
+RGD_CAPI_API RgdCApiResult rgd_analysis_get_crashing_process_path(RgdAnalysisHandle handle, const char** out_path);
+
+// One-shot convenience: parses the dump and pumps every requested section
+// ("markers_in_progress", "execution_marker_tree", "page_fault_summary")
+// through the callback, without touching the filesystem for output.
+RGD_CAPI_API RgdCApiResult rgd_analyze(const char* crash_dump_path,
+                                       const RgdAnalyzeOptions* options,
+                                       RgdSectionCallback on_section,
+                                       void* user_data);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_CAPI_H_
@@ -0,0 +1,57 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  flat command buffer to execution marker event index mapping.
+//=============================================================================
+#include "rgd_cmd_buffer_mapping.h"
+
+// C++.
+#include <algorithm>
+
+void RgdCmdBufferMapping::Build(const std::unordered_map<uint64_t, std::vector<size_t>>& per_cmd_buffer_indices)
+{
+    Clear();
+
+    // Size both arrays exactly once.
+    size_t total_index_count = 0;
+    for (const auto& mapping_entry : per_cmd_buffer_indices)
+    {
+        total_index_count += mapping_entry.second.size();
+    }
+    ranges_.reserve(per_cmd_buffer_indices.size());
+    event_indices_.reserve(total_index_count);
+
+    // Lay the ranges out sorted by command buffer ID so that lookups can binary
+    // search and iteration order is deterministic across runs.
+    for (const auto& mapping_entry : per_cmd_buffer_indices)
+    {
+        ranges_.push_back(Range{ mapping_entry.first, 0, mapping_entry.second.size() });
+    }
+    std::sort(ranges_.begin(), ranges_.end(), [](const Range& a, const Range& b) { return a.cmd_buffer_id < b.cmd_buffer_id; });
+
+    for (Range& range : ranges_)
+    {
+        const std::vector<size_t>& event_indices = per_cmd_buffer_indices.at(range.cmd_buffer_id);
+        range.first = event_indices_.size();
+        event_indices_.insert(event_indices_.end(), event_indices.begin(), event_indices.end());
+    }
+}
+
+const RgdCmdBufferMapping::Range* RgdCmdBufferMapping::FindRange(uint64_t cmd_buffer_id) const
+{
+    auto iter = std::lower_bound(ranges_.begin(), ranges_.end(), cmd_buffer_id,
+        [](const Range& range, uint64_t id) { return range.cmd_buffer_id < id; });
+    return (iter != ranges_.end() && iter->cmd_buffer_id == cmd_buffer_id) ? &(*iter) : nullptr;
+}
+
+RgdEventIndexSpan RgdCmdBufferMapping::GetSpan(const Range& range) const
+{
+    return RgdEventIndexSpan(event_indices_.data() + range.first, range.count);
+}
+
+void RgdCmdBufferMapping::Clear()
+{
+    event_indices_.clear();
+    ranges_.clear();
+}
@@ -0,0 +1,84 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  flat command buffer to execution marker event index mapping.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_CMD_BUFFER_MAPPING_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_CMD_BUFFER_MAPPING_H_
+
+// C++.
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// A non-owning view over one command buffer's marker event indices inside the
+// flat index array of RgdCmdBufferMapping. Valid as long as the mapping it was
+// obtained from is alive and unmodified.
+class RgdEventIndexSpan
+{
+public:
+    RgdEventIndexSpan() = default;
+    RgdEventIndexSpan(const size_t* data, size_t size) : data_(data), size_(size) {}
+
+    const size_t* begin() const { return data_; }
+    const size_t* end() const { return data_ + size_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t operator[](size_t index) const { return data_[index]; }
+
+private:
+    const size_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Maps each in-flight command buffer ID to the indices of its execution marker
+// events, sorted chronologically. The per-command buffer index lists are stored
+// back to back in one contiguous array, grouped by command buffer ID, with a
+// compact range table (sorted by command buffer ID) on top for lookup. Compared
+// to a map of vectors this keeps the marker traversals - which walk each
+// command buffer's list front to back - on one contiguous allocation, and makes
+// iteration order deterministic.
+class RgdCmdBufferMapping
+{
+public:
+    // One command buffer's slice of the flat index array.
+    struct Range
+    {
+        uint64_t cmd_buffer_id = 0;
+        size_t first = 0;
+        size_t count = 0;
+    };
+
+    // Builds the flat mapping from per-command buffer event index vectors. The
+    // per-command buffer ordering is preserved; the ranges are sorted by
+    // command buffer ID. Any previous contents are replaced.
+    void Build(const std::unordered_map<uint64_t, std::vector<size_t>>& per_cmd_buffer_indices);
+
+    // Returns the range of the given command buffer ID, or nullptr when the
+    // command buffer is not part of the mapping. Note that an in-flight command
+    // buffer can legitimately have an empty range.
+    const Range* FindRange(uint64_t cmd_buffer_id) const;
+
+    // Returns the event index span for the given range.
+    RgdEventIndexSpan GetSpan(const Range& range) const;
+
+    // Returns the range table, sorted by command buffer ID.
+    const std::vector<Range>& GetRanges() const { return ranges_; }
+
+    // Returns the number of command buffers in the mapping.
+    size_t GetCmdBufferCount() const { return ranges_.size(); }
+
+    bool IsEmpty() const { return ranges_.empty(); }
+
+    void Clear();
+
+private:
+    // All command buffers' marker event indices, stored back to back.
+    std::vector<size_t> event_indices_;
+
+    // Per-command buffer slices of event_indices_, sorted by command buffer ID.
+    std::vector<Range> ranges_;
+};
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_CMD_BUFFER_MAPPING_H_
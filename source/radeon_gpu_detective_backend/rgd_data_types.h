@@ -25,6 +25,9 @@
 // System info.
 #include "system_info_utils/source/system_info_reader.h"
 
+// Local.
+#include "rgd_cmd_buffer_mapping.h"
+
 // Marker value is in bits [0:27] while marker source is in bits [28:31].
 static const uint32_t kMarkerValueMask = 0x0FFFFFFF;
 static const uint32_t kMarkerSrcMask = 0xF0000000;
@@ -100,12 +103,18 @@ struct Config
     // Full path to the crash dump input file.
     std::string crash_dump_file;
 
+    // Full path to a directory of crash dump files to analyze in batch mode.
+    std::string parse_directory;
+
     // Full path to the analysis output text file.
     std::string output_file_txt;
 
     // Full path to the analysis output json file.
     std::string output_file_json;
 
+    // Full path to the analysis output binary (MessagePack) file.
+    std::string output_file_bin;
+
     // True for higher level of details for console output.
     bool is_verbose = false;
 
@@ -138,6 +147,18 @@ struct Config
 
     // Include internal barriers in Execution Marker Tree. Internal barriers are filtered out by default.
     bool is_include_internal_barriers = false;
+
+    // Collect per-phase timing and memory statistics and print a JSON breakdown at the end of the analysis.
+    bool is_perf_stats = false;
+
+    // Generate only the crash summary (markers in progress and page fault information),
+    // skipping the execution marker tree. Intended for automated triage runs.
+    bool is_summary_only = false;
+
+    // Memory budget in MiB for the analysis (0 means unlimited). When set, the raw
+    // crash data chunk payloads are compacted down to the retained event records as
+    // they are parsed, and a warning is printed if the process still exceeds the budget.
+    uint64_t max_memory_mb = 0;
 };
 
 // Stores time information about the crash analysis session.
@@ -203,8 +224,9 @@ struct RgdCrashDumpContents
     CrashData umd_crash_data;
     CrashData kmd_crash_data;
     TraceProcessInfo              crashing_app_process_info;
-    // Mapping between command buffer ID and the indices for umd_crash_data.events array of its relevant execution marker events.
-    std::unordered_map<uint64_t, std::vector<size_t>> cmd_buffer_mapping;
+    // Mapping between command buffer ID and the indices for umd_crash_data.events array of its relevant execution marker events,
+    // stored as one flat index array with a compact per-command buffer range table.
+    RgdCmdBufferMapping cmd_buffer_mapping;
 
     // Driver Experiments JSON
     nlohmann::json driver_experiments_json;
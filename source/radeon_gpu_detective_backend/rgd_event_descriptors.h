@@ -0,0 +1,103 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  compile-time descriptor tables for DDEvent record types.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_EVENT_DESCRIPTORS_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_EVENT_DESCRIPTORS_H_
+
+// C++.
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Dev driver.
+#include "dev_driver/include/rgdevents.h"
+
+// Describes one DDEvent record type of a provider stream: the display name used
+// by the raw event serializers and how many bytes the record occupies in the
+// chunk payload. The tables below are built at compile time from the rgdevents.h
+// definitions, so the parser and the serializers cannot disagree on record sizes
+// or names, and id dispatch is a bounds-checked array lookup.
+struct RgdEventDescriptor
+{
+    // Display name of the event for the raw crash data dump. Null for ids that
+    // are unknown to this tool version.
+    const char* name = nullptr;
+
+    // Fixed record size in bytes, or zero when the record size is carried in the
+    // event header (the record then occupies sizeof(DDEventHeader) + eventSize bytes).
+    size_t fixed_size = 0;
+};
+
+// Builds a descriptor for a record type whose full size is known at compile time.
+template <typename EventStruct>
+constexpr RgdEventDescriptor MakeFixedSizeEventDescriptor(const char* name)
+{
+    return RgdEventDescriptor{ name, sizeof(EventStruct) };
+}
+
+// Builds a descriptor for a record whose payload size is carried in the event header.
+constexpr RgdEventDescriptor MakeHeaderSizedEventDescriptor(const char* name)
+{
+    return RgdEventDescriptor{ name, 0 };
+}
+
+// One table slot per event id a provider stream can currently carry.
+constexpr size_t kEventDescriptorTableSize = size_t(DDCommonEventId::FirstEventIdForIndividualProvider) + 4;
+
+// Descriptor table for the UMD provider stream, indexed by event id.
+constexpr std::array<RgdEventDescriptor, kEventDescriptorTableSize> BuildUmdEventDescriptorTable()
+{
+    std::array<RgdEventDescriptor, kEventDescriptorTableSize> table{};
+    table[size_t(DDCommonEventId::RgdEventTimestamp)]            = MakeFixedSizeEventDescriptor<TimestampEvent>("TIMESTAMP");
+    table[size_t(UmdEventId::RgdEventExecutionMarkerBegin)]      = MakeHeaderSizedEventDescriptor("EXEC MARKER BEGIN");
+    table[size_t(UmdEventId::RgdEventExecutionMarkerEnd)]        = MakeHeaderSizedEventDescriptor("EXEC MARKER END");
+    table[size_t(UmdEventId::RgdEventCrashDebugNopData)]         = MakeFixedSizeEventDescriptor<CrashDebugNopData>("DEBUG NOP");
+    table[size_t(UmdEventId::RgdEventExecutionMarkerInfo)]       = MakeHeaderSizedEventDescriptor("EXEC MARKER INFO");
+    return table;
+}
+
+// Descriptor table for the KMD provider stream, indexed by event id.
+constexpr std::array<RgdEventDescriptor, kEventDescriptorTableSize> BuildKmdEventDescriptorTable()
+{
+    std::array<RgdEventDescriptor, kEventDescriptorTableSize> table{};
+    table[size_t(DDCommonEventId::RgdEventTimestamp)] = MakeFixedSizeEventDescriptor<TimestampEvent>("TIMESTAMP");
+    table[size_t(KmdEventId::RgdEventVmPageFault)]    = MakeHeaderSizedEventDescriptor("PAGE FAULT");
+    return table;
+}
+
+constexpr std::array<RgdEventDescriptor, kEventDescriptorTableSize> kUmdEventDescriptors = BuildUmdEventDescriptorTable();
+constexpr std::array<RgdEventDescriptor, kEventDescriptorTableSize> kKmdEventDescriptors = BuildKmdEventDescriptorTable();
+
+// Bounds-checked lookup. Ids beyond the table or without a registered descriptor
+// return an unknown descriptor (null name, header-carried size), matching how the
+// parser skips events added by newer drivers.
+constexpr RgdEventDescriptor GetUmdEventDescriptor(uint8_t event_id)
+{
+    return (event_id < kUmdEventDescriptors.size()) ? kUmdEventDescriptors[event_id] : RgdEventDescriptor{};
+}
+
+constexpr RgdEventDescriptor GetKmdEventDescriptor(uint8_t event_id)
+{
+    return (event_id < kKmdEventDescriptors.size()) ? kKmdEventDescriptors[event_id] : RgdEventDescriptor{};
+}
+
+// Returns the number of payload bytes the record occupies.
+constexpr size_t GetEventRecordSize(const RgdEventDescriptor& descriptor, const DDEventHeader& header)
+{
+    return (descriptor.fixed_size != 0) ? descriptor.fixed_size : sizeof(DDEventHeader) + header.eventSize;
+}
+
+// The parser advances by these exact sizes; keep the tables in lock-step with rgdevents.h.
+static_assert(GetUmdEventDescriptor(uint8_t(DDCommonEventId::RgdEventTimestamp)).fixed_size == sizeof(TimestampEvent),
+    "timestamp descriptor out of sync with rgdevents.h");
+static_assert(GetUmdEventDescriptor(uint8_t(UmdEventId::RgdEventCrashDebugNopData)).fixed_size == sizeof(CrashDebugNopData),
+    "crash debug NOP descriptor out of sync with rgdevents.h");
+static_assert(GetUmdEventDescriptor(uint8_t(UmdEventId::RgdEventExecutionMarkerBegin)).fixed_size == 0,
+    "execution marker begin records are sized by their event header");
+static_assert(GetKmdEventDescriptor(uint8_t(KmdEventId::RgdEventVmPageFault)).fixed_size == 0,
+    "page fault records are sized by their event header");
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_EVENT_DESCRIPTORS_H_
@@ -1,4 +1,4 @@
-﻿//=============================================================================
+//=============================================================================
 // Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
 /// @author AMD Developer Tools Team
 /// @file
@@ -12,7 +12,7 @@
 #include <string>
 #include <sstream>
 #include <cassert>
-#include <string_view>
+#include <cstring>
 
 // RGD
 #include "rgd_utils.h"
@@ -22,8 +22,6 @@
 static const char* kJsonElemMarkers = "markers";
 static const char* kJsonElemEvents = "events";
 
-static const char* kExecTreeDummyRootString = "rgd_internal_dummy_exec_marker_tree_root_node";
-
 static const char* kMarkerSrcApplication = "App";
 static const char* kMarkerSrcAPILayer = "Driver-DX12";
 static const char* kMarkerSrcPal = "Driver-PAL";
@@ -61,7 +59,7 @@ static std::string GenerateBarrierString()
     // Surround "Barrier" strings with a line to clearly separate the markers before and after the "Barrier".
     const char* kBarrierSymbol = "----------";
     std::stringstream ret_txt;
-    
+
     ret_txt << kBarrierSymbol;
     ret_txt << kBarrierStandard;
     ret_txt << kBarrierSymbol;
@@ -76,19 +74,23 @@ void ExecMarkerTreeSerializer::PushMarkerBegin(uint64_t timestamp, uint32_t mark
 #ifdef _DEBUG
     UpdateAndValidateTimestamp(timestamp);
 #endif
+    assert(!is_tree_finalized_);
 
-    MarkerNode new_marker_node(timestamp, marker_value, str);
+    const size_t new_node_index = node_pool_.size();
+    node_pool_.emplace_back(timestamp, marker_value, string_pool_.Intern(str));
     if (current_stack_.empty())
     {
-        marker_nodes_.push_back(std::move(new_marker_node));
-        current_stack_.push_back(&marker_nodes_.back());
+        top_level_node_indices_.push_back(new_node_index);
     }
     else
     {
-        MarkerNode* curr_marker_node = current_stack_.back();
-        curr_marker_node->child_markers.push_back(std::move(new_marker_node));
-        current_stack_.push_back(&curr_marker_node->child_markers.back());
+        // Record the parent link and count the child; the contiguous child index
+        // ranges are laid out by FinalizeTree() once the tree is complete.
+        const size_t parent_index = current_stack_.back();
+        node_pool_[new_node_index].parent_index = parent_index;
+        ++node_pool_[parent_index].child_count;
     }
+    current_stack_.push_back(new_node_index);
 }
 
 // Update marker info event for DrawInfo, DispatchInfo BarrierBeginInfo and BarrierEndInfo.
@@ -99,7 +101,7 @@ void ExecMarkerTreeSerializer::UpdateMarkerInfo(uint32_t marker_value, const uin
     if (!current_stack_.empty())
     {
         // Marker Info event for Draw, Dispatch and Barrier is always preceded by Marker Begin event for the same marker value.
-        MarkerNode& node = *current_stack_.back();
+        MarkerNode& node = node_pool_[current_stack_.back()];
         assert(node.marker_value == marker_value);
         if (node.marker_value == marker_value)
         {
@@ -117,7 +119,7 @@ void ExecMarkerTreeSerializer::UpdateMarkerInfo(uint32_t marker_value, const uin
 
     if (is_invalid_info_marker)
     {
-        // There is no matching 'ExecutionMarkerBegin' for this 'ExecutionMarkerInfo' event. 
+        // There is no matching 'ExecutionMarkerBegin' for this 'ExecutionMarkerInfo' event.
         std::stringstream warning_msg;
         warning_msg << "detected an 'ExecutionMarkerInfo' event with no matching 'ExecutionMarkerBegin' event for the marker value=0x" << std::hex << marker_value << std::dec << ".";
         RgdUtils::PrintMessage(warning_msg.str().c_str(), RgdMessageType::kWarning, true);
@@ -134,28 +136,78 @@ void ExecMarkerTreeSerializer::PushMarkerEnd(uint64_t timestamp, uint32_t marker
     assert(!current_stack_.empty());
     if (!current_stack_.empty())
     {
-        current_stack_.back()->timestamp_end_ = timestamp;
-        assert(current_stack_.back()->marker_value == marker_value);
+        node_pool_[current_stack_.back()].timestamp_end_ = timestamp;
+        assert(node_pool_[current_stack_.back()].marker_value == marker_value);
         current_stack_.pop_back();
     }
 }
 
+void ExecMarkerTreeSerializer::FinalizeTree()
+{
+    if (!is_tree_finalized_)
+    {
+        // Every node except the top level markers occupies exactly one child slot.
+        child_indices_.resize(node_pool_.size() - top_level_node_indices_.size());
+
+        // First pass: assign each node the start of its child range.
+        size_t next_child_slot = 0;
+        for (MarkerNode& node : node_pool_)
+        {
+            node.child_begin = next_child_slot;
+            next_child_slot += node.child_count;
+
+            // Reused as the fill cursor in the scatter pass below.
+            node.child_count = 0;
+        }
+
+        // Second pass: scatter every node into its parent's range. Nodes were
+        // appended to the pool in event order, so each range stays sorted by
+        // begin timestamp.
+        for (size_t node_index = 0; node_index < node_pool_.size(); node_index++)
+        {
+            const size_t parent_index = node_pool_[node_index].parent_index;
+            if (parent_index != kMarkerNodeInvalidIndex)
+            {
+                MarkerNode& parent_node = node_pool_[parent_index];
+                child_indices_[parent_node.child_begin + parent_node.child_count] = node_index;
+                ++parent_node.child_count;
+            }
+        }
+
+        is_tree_finalized_ = true;
+    }
+}
+
+size_t ExecMarkerTreeSerializer::GetChildCount(size_t node_index) const
+{
+    assert(is_tree_finalized_);
+    return (node_index == kMarkerNodeInvalidIndex) ? top_level_node_indices_.size() : node_pool_[node_index].child_count;
+}
+
+size_t ExecMarkerTreeSerializer::GetChildNodeIndex(size_t node_index, size_t child_position) const
+{
+    assert(is_tree_finalized_);
+    return (node_index == kMarkerNodeInvalidIndex)
+        ? top_level_node_indices_[child_position]
+        : child_indices_[node_pool_[node_index].child_begin + child_position];
+}
+
 void ExecMarkerTreeSerializer::ValidateExecutionMarkers()
 {
     if (!current_stack_.empty())
     {
-        // current_stack_ holds the 'begin' markers when building the execution marker tree nodes in marker_nodes_.
+        // current_stack_ holds the 'begin' markers when building the execution marker tree nodes in node_pool_.
         // 'end' marker is missing for each remaining 'begin' marker in the stack.
         std::stringstream txt;
 
         // Add a info message for each missing 'end' marker.
         while (!current_stack_.empty())
         {
-            const MarkerNode& current_node = *current_stack_.back();
+            const MarkerNode& current_node = node_pool_[current_stack_.back()];
             if (GetItemStatus(current_node) == MarkerExecutionStatus::kInProgress)
             {
                 std::stringstream console_msg;
-                console_msg << "detected a missing 'End' (pop) event for marker named \"" << current_node.marker_str << "\". Marker hierarchy might be impacted.";
+                console_msg << "detected a missing 'End' (pop) event for marker named \"" << GetMarkerString(current_node) << "\". Marker hierarchy might be impacted.";
                 txt << "Note: " << console_msg.str() << std::endl;
                 RgdUtils::PrintMessage(console_msg.str().c_str(), RgdMessageType::kInfo, true);
             }
@@ -176,11 +228,11 @@ std::string ExecMarkerTreeSerializer::SummaryListToString() const
         txt << std::endl << missing_markers_info_txt_ << std::endl;
     }
 
-    std::vector<const MarkerNode*> marker_stack;
-    for (const auto& marker_node : marker_nodes_)
+    std::vector<size_t> marker_stack;
+    for (size_t node_index : top_level_node_indices_)
     {
         bool is_atleast_one_child_in_progress_place_holdler = false;
-        marker_stack.push_back(&marker_node);
+        marker_stack.push_back(node_index);
         txt << GenerateSummaryString(marker_stack, is_atleast_one_child_in_progress_place_holdler);
         marker_stack.pop_back();
     }
@@ -189,106 +241,247 @@ std::string ExecMarkerTreeSerializer::SummaryListToString() const
 
 void ExecMarkerTreeSerializer::SummaryListToJson(nlohmann::json& summary_list_json) const
 {
-    std::vector<const MarkerNode*> marker_stack;
+    std::vector<size_t> marker_stack;
 
     summary_list_json[kJsonElemMarkers] = nlohmann::json::array();
-    for (const auto& marker_node : marker_nodes_)
+    for (size_t node_index : top_level_node_indices_)
     {
         bool is_atleast_one_child_in_progress_place_holdler = false;
-        marker_stack.push_back(&marker_node);
+        marker_stack.push_back(node_index);
         GenerateSummaryJson(marker_stack, summary_list_json, is_atleast_one_child_in_progress_place_holdler);
         marker_stack.pop_back();
     }
 }
 
-void ExecMarkerTreeSerializer::GenerateSummaryJson(std::vector<const MarkerNode*>& marker_stack,
+void ExecMarkerTreeSerializer::GenerateSummaryJson(std::vector<size_t>& marker_stack,
     nlohmann::json& marker_summary_json, bool& is_atleast_one_child_in_progress) const
 {
-    const MarkerNode* const node = marker_stack.back();
-    assert(node != nullptr);
-    if (node != nullptr)
+    const MarkerNode& node = node_pool_[marker_stack.back()];
+    if (GetItemStatus(node) == MarkerExecutionStatus::kInProgress)
     {
-        if (GetItemStatus(*node) == MarkerExecutionStatus::kInProgress)
+        is_atleast_one_child_in_progress = true;
+        bool is_atleast_one_child_of_current_in_progress = false;
+
+        for (size_t i = 0, count = node.child_count; i < count; ++i)
         {
-            is_atleast_one_child_in_progress = true;
-            bool is_atleast_one_child_of_current_in_progress = false;
+            marker_stack.push_back(child_indices_[node.child_begin + i]);
+            GenerateSummaryJson(marker_stack, marker_summary_json, is_atleast_one_child_of_current_in_progress);
+            marker_stack.pop_back();
+        }
 
-            for (const auto& child_marker : node->child_markers)
+        if (!is_atleast_one_child_of_current_in_progress)
+        {
+            // When none of the child nodes are "in progress" or there are no child marker nodes, current node is the last "in progress" node in the tree path.
+            // Print the path from root until the current node.
+            std::stringstream txt;
+
+            for (size_t i = 0, count = marker_stack.size(); i + 1 < count; ++i)
             {
-                marker_stack.push_back(&child_marker);
-                GenerateSummaryJson(marker_stack, marker_summary_json, is_atleast_one_child_of_current_in_progress);
-                marker_stack.pop_back();
+                txt << GetMarkerString(node_pool_[marker_stack[i]]) << '/';
             }
-
-            if (!is_atleast_one_child_of_current_in_progress)
+            const MarkerNode& last_node = node_pool_[marker_stack.back()];
+            if (kBarrierMarkerStrings.find(GetMarkerString(last_node)) != kBarrierMarkerStrings.end())
             {
-                // When none of the child nodes are "in progress" or there are no child marker nodes, current node is the last "in progress" node in the tree path.
-                // Print the path from root until the current node.
-                std::stringstream txt;
-
-                for (size_t i = 0, count = marker_stack.size(); i + 1 < count; ++i)
-                {
-                    txt << marker_stack[i]->marker_str << '/';
-                }
-                if (kBarrierMarkerStrings.find(marker_stack.back()->marker_str) != kBarrierMarkerStrings.end())
-                {
-                    // Replace barrier marker strings with standard string for the barrier marker.
-                    txt << kBarrierStandard;
-                }
-                else
-                {
-                    txt << marker_stack.back()->marker_str;
-                }
-                marker_summary_json[kJsonElemMarkers].push_back(txt.str());
+                // Replace barrier marker strings with standard string for the barrier marker.
+                txt << kBarrierStandard;
+            }
+            else
+            {
+                txt << GetMarkerString(last_node);
             }
+            marker_summary_json[kJsonElemMarkers].push_back(txt.str());
         }
     }
 }
 
 std::string ExecMarkerTreeSerializer::TreeToString(const Config& user_config) const
 {
-    std::vector<bool> is_last_on_level;
-    std::stringstream txt;
+    // In the tree level, the maximum consecutive nodes of same status to print.
+    // When a tree level has more consecutive nodes of same status than KMaxNodesOfSameStatusToPrint,
+    // first and last (kMaxNodesOfSameStatusToPrint - kMinNumberOfNodesToSquash) / 2 nodes will be printed,
+    // And in between nodes will be squashed, with count of nodes squashed printed.
+    const size_t kMaxNodesOfSameStatusToPrint = 33;
+    const size_t kMinNumberOfNodesToSquash = 9;
+
+    // A node whose children are currently being visited by the explicit-stack traversal.
+    struct TraversalFrame
+    {
+        // Pool index of the node (kMarkerNodeInvalidIndex for the implicit root).
+        size_t node_index = 0;
+
+        // Position of the next child to visit.
+        size_t next_child = 0;
+        size_t child_count = 0;
+
+        // Length to restore the shared prefix string to when this frame is popped.
+        size_t prefix_length = 0;
+
+        // Squashing state for consecutive same-status children on this level.
+        size_t total_nodes_with_same_status = 0;
+        size_t first_skip_idx = 0;
+        size_t last_skip_idx = 0;
+    };
+
+    std::string txt;
+    txt.reserve(node_pool_.size() * 64);
 
     // Add missing pop markers info for execution marker tree.
     if (!missing_markers_info_txt_.empty())
     {
-        txt << std::endl << missing_markers_info_txt_ << std::endl;
+        txt += '\n';
+        txt += missing_markers_info_txt_;
+        txt += '\n';
     }
 
-    // Dummy parent/root node to hold top level markers list.
-    MarkerNode dummy_root(0,0,kExecTreeDummyRootString);
+    // Reusable indentation prefix shared by every emitted line, and the
+    // "is last sibling" flag per level (consulted by the squashed-nodes block).
+    std::string prefix;
+    std::vector<bool> is_last_on_level;
+    std::vector<TraversalFrame> traversal_stack;
+
+    // Start at the implicit root (kMarkerNodeInvalidIndex) whose children are
+    // the top level markers. The root itself is not printed.
+    traversal_stack.push_back({ kMarkerNodeInvalidIndex, 0, GetChildCount(kMarkerNodeInvalidIndex), 0, 0, 0, 0 });
+    is_last_on_level.push_back(false);
+
+    while (!traversal_stack.empty())
+    {
+        TraversalFrame& frame = traversal_stack.back();
+        if (frame.next_child == frame.child_count)
+        {
+            prefix.resize(frame.prefix_length);
+            is_last_on_level.pop_back();
+            traversal_stack.pop_back();
+            continue;
+        }
 
-    dummy_root.child_markers = marker_nodes_;
+        const size_t parent_node_index = frame.node_index;
+        const size_t i = frame.next_child++;
+        const size_t child_index = GetChildNodeIndex(parent_node_index, i);
+        const bool is_last_child = (i + 1 == frame.child_count);
 
-    txt << TreeNodeToString(is_last_on_level, dummy_root, user_config);
-    return txt.str();
+        // The last child on a level is always printed; the squashing state only
+        // tracks the preceding siblings.
+        bool is_printed = true;
+        if (!is_last_child)
+        {
+            const MarkerNode& child_node = node_pool_[child_index];
+            if (!user_config.is_expand_markers && child_node.repeating_same_status_count != 0 && frame.total_nodes_with_same_status == 0)
+            {
+                // For default output, squash the repeated nodes with same status on the same level.
+                frame.total_nodes_with_same_status = child_node.repeating_same_status_count + 1;
+                const size_t kNodesToPrint = kMaxNodesOfSameStatusToPrint - kMinNumberOfNodesToSquash;
+                frame.first_skip_idx = i + (kNodesToPrint / 2);
+                frame.last_skip_idx = frame.first_skip_idx + (frame.total_nodes_with_same_status - kNodesToPrint);
+            }
+            else if (child_node.repeating_same_status_count == 0)
+            {
+                frame.total_nodes_with_same_status = 0;
+            }
+
+            is_printed = (frame.total_nodes_with_same_status == 0 || i < frame.first_skip_idx || i > frame.last_skip_idx);
+            if (!is_printed && i == frame.first_skip_idx)
+            {
+                // Print occurrence count information of the squashed nodes.
+                const size_t kParentIndentationDepth = is_last_on_level.size() - 1;
+                for (size_t k = 0; k < 3; ++k)
+                {
+                    for (size_t j = 0; j < kParentIndentationDepth + 1; ++j)
+                    {
+                        // Print ellipse for squashed nodes.
+                        // is_last_on_level[0] represents the implicit root node level.
+                        // For j = 0; print ellipse only when squashing is done at top level.
+                        if (parent_node_index == kMarkerNodeInvalidIndex || j > 0)
+                        {
+                            if (is_last_on_level[j])
+                            {
+                                txt += (is_file_visualization_ ? "   " : "    ");
+                            }
+                            else if (k == 1)
+                            {
+                                // Print vertical ellipsis '⋮'.
+                                txt += (is_file_visualization_ ? " \xe2\x81\x9e " : " |  ");
+                                if (j == kParentIndentationDepth)
+                                {
+                                    const size_t occurrences = frame.last_skip_idx - frame.first_skip_idx + 1;
+                                    txt += "(";
+                                    txt += std::to_string(occurrences);
+                                    txt += " consecutive occurrences of ";
+                                    txt += MarkerExecStatusToString(GetItemStatus(node_pool_[GetChildNodeIndex(parent_node_index, frame.first_skip_idx)]));
+                                    txt += " nodes)";
+                                }
+                            }
+                            else
+                            {
+                                // |
+                                txt += (is_file_visualization_ ? " \xe2\x94\x82 " : " |  ");
+                            }
+                        }
+                    }
+                    txt += '\n';
+                }
+            }
+        }
+
+        if (is_printed)
+        {
+            is_last_on_level.back() = is_last_child;
+            AppendTreeNodeLine(txt, prefix, is_last_child, parent_node_index == kMarkerNodeInvalidIndex, child_index, user_config);
+
+            // if 'expand_markers' is specified, expand all marker nodes.
+            // For default output, only expand 'in progress' nodes.
+            const MarkerExecutionStatus status = GetItemStatus(node_pool_[child_index]);
+            if ((user_config.is_expand_markers || status == MarkerExecutionStatus::kInProgress) && GetChildCount(child_index) > 0)
+            {
+                // Descend: the child's own level joins the reusable prefix. Top
+                // level markers contribute no continuation column.
+                const size_t restore_length = prefix.length();
+                if (parent_node_index != kMarkerNodeInvalidIndex)
+                {
+                    if (is_last_child)
+                    {
+                        prefix += (is_file_visualization_ ? "   " : "    ");
+                    }
+                    else
+                    {
+                        // |
+                        prefix += (is_file_visualization_ ? " \xe2\x94\x82 " : " |  ");
+                    }
+                }
+                traversal_stack.push_back({ child_index, 0, GetChildCount(child_index), restore_length, 0, 0, 0 });
+                is_last_on_level.push_back(false);
+            }
+        }
+    }
+
+    return txt;
 }
 
 void ExecMarkerTreeSerializer::TreeToJson(const Config& user_config, nlohmann::json& marker_tree_json) const
 {
-    for (const auto& item : marker_nodes_)
+    for (size_t node_index : top_level_node_indices_)
     {
         nlohmann::json marker_node_json;
-        TreeNodeToJson(item, marker_node_json, user_config);
+        TreeNodeToJson(node_index, marker_node_json, user_config);
         marker_tree_json[kJsonElemEvents].push_back(marker_node_json);
     }
 }
 
-void ExecMarkerTreeSerializer::TreeNodeToJson(const MarkerNode& node, nlohmann::json& marker_node_json, const Config& user_config) const
+void ExecMarkerTreeSerializer::TreeNodeToJson(size_t node_index, nlohmann::json& marker_node_json, const Config& user_config) const
 {
     const char* kJsonElemMarkerExecStatus = "execution_status";
     const char* kJsonElemMarkerSrc = "marker_source";
     const char* KJsonElemName = "name";
     const char* kJsonElemIndexCount = "index_count";
     const char* kJsonElemVertexCount = "vertex_count";
-    if (kBarrierMarkerStrings.find(node.marker_str) != kBarrierMarkerStrings.end())
+    const MarkerNode& node = node_pool_[node_index];
+    if (kBarrierMarkerStrings.find(GetMarkerString(node)) != kBarrierMarkerStrings.end())
     {
         marker_node_json[KJsonElemName] = kBarrierStandard;
     }
     else
     {
-        marker_node_json[KJsonElemName] = node.marker_str;
+        marker_node_json[KJsonElemName] = GetMarkerString(node);
     }
 
     uint8_t* marker_info = const_cast<uint8_t*>(node.marker_info);
@@ -365,10 +558,10 @@ void ExecMarkerTreeSerializer::TreeNodeToJson(const MarkerNode& node, nlohmann::
 
     if (status == MarkerExecutionStatus::kInProgress)
     {
-        for (size_t i = 0; i < node.child_markers.size(); ++i)
+        for (size_t i = 0, count = node.child_count; i < count; ++i)
         {
             nlohmann::json child_marker_node_json;
-            TreeNodeToJson(node.child_markers[i], child_marker_node_json, user_config);
+            TreeNodeToJson(child_indices_[node.child_begin + i], child_marker_node_json, user_config);
             marker_node_json[kJsonElemEvents].push_back(child_marker_node_json);
         }
     }
@@ -394,54 +587,51 @@ void ExecMarkerTreeSerializer::UpdateAndValidateTimestamp(uint64_t timestamp)
 }
 #endif
 
-std::string ExecMarkerTreeSerializer::GenerateSummaryString(std::vector<const MarkerNode*>& marker_stack, bool& is_atleast_one_child_in_progress) const
+std::string ExecMarkerTreeSerializer::GenerateSummaryString(std::vector<size_t>& marker_stack, bool& is_atleast_one_child_in_progress) const
 {
 
     std::stringstream txt;
-    const MarkerNode* const node = marker_stack.back();
-    assert(node != nullptr);
-    if (node != nullptr)
+    const MarkerNode& node = node_pool_[marker_stack.back()];
+    if (GetItemStatus(node) == MarkerExecutionStatus::kInProgress)
     {
-        if (GetItemStatus(*node) == MarkerExecutionStatus::kInProgress)
+        is_atleast_one_child_in_progress = true;
+        bool is_atleast_one_child_of_current_in_progress = false;
+
+        for (size_t i = 0, count = node.child_count; i < count; ++i)
         {
-            is_atleast_one_child_in_progress = true;
-            bool is_atleast_one_child_of_current_in_progress = false;
+            marker_stack.push_back(child_indices_[node.child_begin + i]);
+            txt << GenerateSummaryString(marker_stack, is_atleast_one_child_of_current_in_progress);
+            marker_stack.pop_back();
+        }
 
-            for (const auto& child_marker : node->child_markers)
-            {
-                marker_stack.push_back(&child_marker);
-                txt << GenerateSummaryString(marker_stack, is_atleast_one_child_of_current_in_progress);
-                marker_stack.pop_back();
-            }
+        if (!is_atleast_one_child_of_current_in_progress)
+        {
+            // When none of the child nodes are "in progress" or there are no child marker nodes, current node is the last "in progress" node in the tree path.
+            // Print the path from root until the current node.
 
-            if (!is_atleast_one_child_of_current_in_progress)
+            // Do not include the consecutive repeating occurrences of identical nodes in text summary list.
+            if (node.is_include_node_in_text_summary_list)
             {
-                // When none of the child nodes are "in progress" or there are no child marker nodes, current node is the last "in progress" node in the tree path.
-                // Print the path from root until the current node.
-
-                // Do not include the consecutive repeating occurrences of identical nodes in text summary list.
-                if (node->is_include_node_in_text_summary_list)
+                for (size_t i = 0, count = marker_stack.size(); i + 1 < count; ++i)
                 {
-                    for (size_t i = 0, count = marker_stack.size(); i + 1 < count; ++i)
-                    {
-                        txt << marker_stack[i]->marker_str << '/';
-                    }
-                    if (kBarrierMarkerStrings.find(marker_stack.back()->marker_str) != kBarrierMarkerStrings.end())
-                    {
-                        // Replace barrier marker strings with standard string for the barrier marker.
-                        txt << kBarrierStandard;
-                    }
-                    else
-                    {
-                        txt << marker_stack.back()->marker_str;
-                    }
+                    txt << GetMarkerString(node_pool_[marker_stack[i]]) << '/';
+                }
+                const MarkerNode& last_node = node_pool_[marker_stack.back()];
+                if (kBarrierMarkerStrings.find(GetMarkerString(last_node)) != kBarrierMarkerStrings.end())
+                {
+                    // Replace barrier marker strings with standard string for the barrier marker.
+                    txt << kBarrierStandard;
+                }
+                else
+                {
+                    txt << GetMarkerString(last_node);
+                }
 
-                    if (node->consecutive_identical_nodes_count > 0)
-                    {
-                        txt << " [" << node->consecutive_identical_nodes_count + 1 << " repeating occurrences]";
-                    }
-                    txt << std::endl;
+                if (node.consecutive_identical_nodes_count > 0)
+                {
+                    txt << " [" << node.consecutive_identical_nodes_count + 1 << " repeating occurrences]";
                 }
+                txt << std::endl;
             }
         }
     }
@@ -449,303 +639,221 @@ std::string ExecMarkerTreeSerializer::GenerateSummaryString(std::vector<const Ma
     return txt.str();
 }
 
-std::string ExecMarkerTreeSerializer::TreeNodeToString(std::vector<bool> is_last_on_level, const MarkerNode& item, const Config& user_config) const
+void ExecMarkerTreeSerializer::AppendTreeNodeLine(std::string& out, const std::string& prefix, bool is_last_child,
+    bool is_top_level, size_t node_index, const Config& user_config) const
 {
-    // In the tree level, the maximum consecutive nodes of same status to print.
-    // When a tree level has more consecutive nodes of same status than KMaxNodesOfSameStatusToPrint,
-    // first and last (kMaxNodesOfSameStatusToPrint - kMinNumberOfNodesToSquash) / 2 nodes will be printed,
-    // And in between nodes will be squashed, with count of nodes squashed printed.
-    const size_t kMaxNodesOfSameStatusToPrint = 33;
-    const size_t kMinNumberOfNodesToSquash = 9;
-
-    std::stringstream txt;
-    const size_t kIndentationDepth = is_last_on_level.size();
-
-    // An internal dummy root node is created as a parent to these top level marker nodes.
-    // kIndentationDepth = 1, represents indentation depth for the top level marker nodes (from marker_node_ list).
-    // Dummy root node is not printed. So kIndentationDepth = 1 is ignored.
-    if (kIndentationDepth > 1)
+    // An implicit root node (kMarkerNodeInvalidIndex) is the parent of the top level marker nodes.
+    // The implicit root node is not printed and the top level markers carry no branch glyphs.
+    if (!is_top_level)
     {
-        for (size_t i = 1; i + 1 < kIndentationDepth; ++i)
-        {
-            if (is_last_on_level[i])
-            {
-                txt << (is_file_visualization_ ? "   " : "    ");
-            }
-            else
-            {
-                // |
-                txt << (is_file_visualization_ ? " \xe2\x94\x82 " : " |  ");
-            }
-        }
-
-        if (is_last_on_level.back())
+        out += prefix;
+        if (is_last_child)
         {
             // '--
-            txt << (is_file_visualization_ ? " \xe2\x94\x94\xe2\x94\x80" : " '--");
+            out += (is_file_visualization_ ? " \xe2\x94\x94\xe2\x94\x80" : " '--");
         }
         else
         {
             // |--
-            txt << (is_file_visualization_ ? " \xe2\x94\x9c\xe2\x94\x80" : " |--");
+            out += (is_file_visualization_ ? " \xe2\x94\x9c\xe2\x94\x80" : " |--");
         }
     }
-    MarkerExecutionStatus status = MarkerExecutionStatus::kInProgress;
 
-    // Do not print if this is an internally added "dummy Exec marker tree root node".
-    if (item.marker_str != kExecTreeDummyRootString)
-    {
-        // Execution status.
-        status = GetItemStatus(item);
-        switch (status)
-        {
-        case MarkerExecutionStatus::kNotStarted:
-            txt << "[ ] ";
-            break;
-        case MarkerExecutionStatus::kInProgress:
-            txt << "[>] ";
-            break;
-        case MarkerExecutionStatus::kFinished:
-            txt << "[X] ";
-            break;
-        default:
-            assert(0);
-        }
+    const MarkerNode& item = node_pool_[node_index];
 
-        // Generate the string.
-        // Wrap the marker string in double quotes if source is application.
-        if (((item.marker_value & kMarkerSrcMask) >> (kUint32Bits - kMarkerSrcBitLen)) == (uint32_t)CrashAnalysisExecutionMarkerSource::Application)
-        {
-            txt << "\"" << item.marker_str << "\"";
-        }
-        else if (kBarrierMarkerStrings.find(item.marker_str) != kBarrierMarkerStrings.end())
-        {
-            // Following marker strings from driver are replaced with standard string "Barrier" in Execution Marker Tree output.
-            // 'Release', 'Acquire', 'ReleaseEvent', 'AcquireEvent' and 'ReleaseThenAcquire'.
-            // Example - marker string 'ReleaseThenAcquire' is replace with '----------Barrier----------'.
-            txt << GenerateBarrierString();
-        }
-        else
-        {
-            txt << item.marker_str;
-        }
+    // Execution status.
+    switch (GetItemStatus(item))
+    {
+    case MarkerExecutionStatus::kNotStarted:
+        out += "[ ] ";
+        break;
+    case MarkerExecutionStatus::kInProgress:
+        out += "[>] ";
+        break;
+    case MarkerExecutionStatus::kFinished:
+        out += "[X] ";
+        break;
+    default:
+        assert(0);
+    }
 
-        uint8_t* marker_info = const_cast<uint8_t*>(item.marker_info);
-        ExecutionMarkerInfoHeader* exec_marker_info_header = reinterpret_cast<ExecutionMarkerInfoHeader*>(marker_info);
-        if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::Dispatch)
-        {
-            // Print thread dimensions from the dispatch info event.
-            DispatchInfo* dispatch_info = reinterpret_cast<DispatchInfo*>(marker_info + sizeof(ExecutionMarkerInfoHeader));
-            txt << "(ThreadGroupCount=[" << dispatch_info->threadX << "," << dispatch_info->threadY << "," << dispatch_info->threadZ << "])";
-        }
-        else if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::Draw)
-        {
-            // Print the index count and instance count.
-            const char* kIndexCountStr = "IndexCount";
-            const char* kInstanceCountStr = "InstanceCount";
-            const char* kVertexCountStr   = "VertexCount";
-            std::string count_type_string = kVertexCountStr;
+    // Generate the string.
+    // Wrap the marker string in double quotes if source is application.
+    if (((item.marker_value & kMarkerSrcMask) >> (kUint32Bits - kMarkerSrcBitLen)) == (uint32_t)CrashAnalysisExecutionMarkerSource::Application)
+    {
+        out += '"';
+        out += GetMarkerString(item);
+        out += '"';
+    }
+    else if (kBarrierMarkerStrings.find(GetMarkerString(item)) != kBarrierMarkerStrings.end())
+    {
+        // Following marker strings from driver are replaced with standard string "Barrier" in Execution Marker Tree output.
+        // 'Release', 'Acquire', 'ReleaseEvent', 'AcquireEvent' and 'ReleaseThenAcquire'.
+        // Example - marker string 'ReleaseThenAcquire' is replace with '----------Barrier----------'.
+        out += GenerateBarrierString();
+    }
+    else
+    {
+        out += GetMarkerString(item);
+    }
 
-            DrawInfo* draw_info = reinterpret_cast<DrawInfo*>(marker_info + sizeof(ExecutionMarkerInfoHeader));
+    uint8_t* marker_info = const_cast<uint8_t*>(item.marker_info);
+    ExecutionMarkerInfoHeader* exec_marker_info_header = reinterpret_cast<ExecutionMarkerInfoHeader*>(marker_info);
+    if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::Dispatch)
+    {
+        // Print thread dimensions from the dispatch info event.
+        DispatchInfo* dispatch_info = reinterpret_cast<DispatchInfo*>(marker_info + sizeof(ExecutionMarkerInfoHeader));
+        out += "(ThreadGroupCount=[";
+        out += std::to_string(dispatch_info->threadX);
+        out += ",";
+        out += std::to_string(dispatch_info->threadY);
+        out += ",";
+        out += std::to_string(dispatch_info->threadZ);
+        out += "])";
+    }
+    else if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::Draw)
+    {
+        // Print the index count and instance count.
+        const char* kIndexCountStr = "IndexCount";
+        const char* kInstanceCountStr = "InstanceCount";
+        const char* kVertexCountStr   = "VertexCount";
+        const char* count_type_string = kVertexCountStr;
 
-            // Vertex count field 'vtxIdxCount' is used for both storing vertex count when it's a non-indexed draw call and index count when it's an indexed draw call.
-            if (draw_info->drawType == CrashAnalysisExecutionMarkerApiType::CRASH_ANALYSIS_EXECUTION_MARKER_API_DRAW_INDEXED_INSTANCED)
-            {
-                count_type_string = kIndexCountStr;
-            }
-                
-            txt << "(" << count_type_string << "=" << draw_info->vtxIdxCount << ", " << kInstanceCountStr << "=" << draw_info->instanceCount << ")";
-        }
+        DrawInfo* draw_info = reinterpret_cast<DrawInfo*>(marker_info + sizeof(ExecutionMarkerInfoHeader));
 
-        if (user_config.is_marker_src)
+        // Vertex count field 'vtxIdxCount' is used for both storing vertex count when it's a non-indexed draw call and index count when it's an indexed draw call.
+        if (draw_info->drawType == CrashAnalysisExecutionMarkerApiType::CRASH_ANALYSIS_EXECUTION_MARKER_API_DRAW_INDEXED_INSTANCED)
         {
-            switch ((item.marker_value & kMarkerSrcMask) >> (kUint32Bits - kMarkerSrcBitLen))
-            {
-            case (uint32_t)CrashAnalysisExecutionMarkerSource::Application:
-                txt << " [" << kMarkerSrcApplication <<"]";
-                break;
-            case (uint32_t)CrashAnalysisExecutionMarkerSource::APILayer:
-                txt << " [" << kMarkerSrcAPILayer << "]";
-                break;
-            case (uint32_t)CrashAnalysisExecutionMarkerSource::PAL:
-                txt << " [" << kMarkerSrcPal << "]";
-                break;
-            case (uint32_t)CrashAnalysisExecutionMarkerSource::Hardware:
-                txt << " [" << kMarkerSrcHw << "]";
-                break;
-            case (uint32_t)CrashAnalysisExecutionMarkerSource::System:
-                break;
-            default:
-                // Should not reach here.
-                assert(false);
-            }
+            count_type_string = kIndexCountStr;
         }
 
-        txt << std::endl;
+        out += "(";
+        out += count_type_string;
+        out += "=";
+        out += std::to_string(draw_info->vtxIdxCount);
+        out += ", ";
+        out += kInstanceCountStr;
+        out += "=";
+        out += std::to_string(draw_info->instanceCount);
+        out += ")";
     }
-    // if 'expand_markers' is specified, expand all marker nodes.
-    // For default output, only expand 'in progress' nodes.
-    if (user_config.is_expand_markers || status == MarkerExecutionStatus::kInProgress)
+
+    if (user_config.is_marker_src)
     {
-        const size_t sub_item_count = item.child_markers.size();
-        if (sub_item_count > 0)
+        switch ((item.marker_value & kMarkerSrcMask) >> (kUint32Bits - kMarkerSrcBitLen))
         {
-            size_t total_nodes_with_same_status = 0;
-            size_t first_skip_idx = 0;
-            size_t last_skip_idx = 0;
-            is_last_on_level.push_back(false);
-            for (size_t i = 0; i + 1 < sub_item_count; ++i)
-            {
-                if (!user_config.is_expand_markers && item.child_markers[i].repeating_same_status_count != 0 && total_nodes_with_same_status == 0)
-                {
-                    // For default output, squash the repeated nodes with same status on the same level.
-                    total_nodes_with_same_status = item.child_markers[i].repeating_same_status_count + 1;
-                    const size_t kNodesToPrint = kMaxNodesOfSameStatusToPrint - kMinNumberOfNodesToSquash;
-                    first_skip_idx = i + (kNodesToPrint / 2);
-                    last_skip_idx = first_skip_idx + (total_nodes_with_same_status - kNodesToPrint);
-                }
-                else if (item.child_markers[i].repeating_same_status_count == 0)
-                {
-                    total_nodes_with_same_status = 0;
-                }
-
-                if (total_nodes_with_same_status == 0 || i < first_skip_idx || i > last_skip_idx)
-                {
-                    txt << TreeNodeToString(is_last_on_level, item.child_markers[i], user_config);
-                }
-                else if (i == first_skip_idx)
-                {
-                    // Print occurrence count information of the squashed nodes.
-                    for (size_t k = 0; k < 3; ++k)
-                    {
-                        for (size_t j = 0; j < kIndentationDepth + 1; ++j)
-                        {
-                            // Print ellipse for squashed nodes.
-                            // is_last_on_level[0] represents the dummy root node level.
-                            // For j = 0; print ellipse only when squashing is done at top level.
-                            if(item.marker_str == kExecTreeDummyRootString || j > 0)
-                            {
-                                if (is_last_on_level[j])
-                                {
-                                    txt << (is_file_visualization_ ? "   " : "    ");
-                                }
-                                else if(k == 1)
-                                {
-                                    // Print vertical ellipsis '⋮'.
-                                    txt << (is_file_visualization_ ? " \xe2\x81\x9e " : " |  ");
-                                    if (j == kIndentationDepth)
-                                    {
-                                        size_t occurrences = last_skip_idx - first_skip_idx + 1;
-                                        txt << "(" << occurrences << " consecutive occurrences of "
-                                            << MarkerExecStatusToString(GetItemStatus(item.child_markers[first_skip_idx])) << " nodes)";
-                                    }
-                                }
-                                else
-                                {
-                                    // |
-                                    txt << (is_file_visualization_ ? " \xe2\x94\x82 " : " |  ");
-                                }
-                            }
-                        }
-                        txt << std::endl;
-                    }
-                }
-            }
-            is_last_on_level.back() = true;
-            txt << TreeNodeToString(is_last_on_level, item.child_markers.back(), user_config);
-            is_last_on_level.pop_back();
+        case (uint32_t)CrashAnalysisExecutionMarkerSource::Application:
+            out += " [";
+            out += kMarkerSrcApplication;
+            out += "]";
+            break;
+        case (uint32_t)CrashAnalysisExecutionMarkerSource::APILayer:
+            out += " [";
+            out += kMarkerSrcAPILayer;
+            out += "]";
+            break;
+        case (uint32_t)CrashAnalysisExecutionMarkerSource::PAL:
+            out += " [";
+            out += kMarkerSrcPal;
+            out += "]";
+            break;
+        case (uint32_t)CrashAnalysisExecutionMarkerSource::Hardware:
+            out += " [";
+            out += kMarkerSrcHw;
+            out += "]";
+            break;
+        case (uint32_t)CrashAnalysisExecutionMarkerSource::System:
+            break;
+        default:
+            // Should not reach here.
+            assert(false);
         }
     }
 
-    return txt.str();
+    out += '\n';
 }
 
 void ExecMarkerTreeSerializer::UpdateSameStatusMarkerNodesCount()
 {
-    for (intmax_t idx = static_cast<intmax_t>(marker_nodes_.size()) - 1; idx > 0; idx--)
+    // Lay out the child index ranges now that the tree is complete.
+    FinalizeTree();
+
+    // Worklist of sibling lists to process, addressed by their parent node.
+    // kMarkerNodeInvalidIndex addresses the implicit root (the top level list).
+    // Each list is visited at most once, and each list is handled with a
+    // single linear pass that resolves every node's status exactly once, so
+    // the total cost is proportional to the node count even for the long flat
+    // runs of identical markers that frame captures produce.
+    std::vector<size_t> pending_parents;
+    pending_parents.push_back(kMarkerNodeInvalidIndex);
+
+    while (!pending_parents.empty())
     {
-        // Process nodes n - 1 to 1.
-        MarkerNode& current_node = marker_nodes_[idx];
-        MarkerNode& previous_node = marker_nodes_[idx - 1];
-
-        const MarkerExecutionStatus current_node_status = GetItemStatus(current_node);
-        const MarkerExecutionStatus previous_node_status = GetItemStatus(previous_node);
+        const size_t parent_index = pending_parents.back();
+        pending_parents.pop_back();
 
-        if (!current_node.child_markers.empty() && current_node_status == MarkerExecutionStatus::kInProgress)
+        const bool is_top_level_list = (parent_index == kMarkerNodeInvalidIndex);
+        const size_t child_count = GetChildCount(parent_index);
+        if (child_count == 0)
         {
-            // Update same status marker nodes count for this node.
-            UpdateSameStatusMarkerNodesCountForThisNode(marker_nodes_[idx]);
+            continue;
         }
 
-        if ((current_node_status != MarkerExecutionStatus::kInProgress || current_node.child_markers.empty())
-            && (previous_node_status != MarkerExecutionStatus::kInProgress || previous_node.child_markers.empty()))
+        // Walk the sibling list from the last node to the first, accumulating
+        // the run lengths backwards. The previous node of one pair is the
+        // current node of the next, so its status lookup is carried over.
+        size_t current_index = GetChildNodeIndex(parent_index, child_count - 1);
+        MarkerExecutionStatus current_status = GetItemStatus(node_pool_[current_index]);
+
+        for (intmax_t idx = static_cast<intmax_t>(child_count) - 1; idx > 0; idx--)
         {
-            if (current_node_status == previous_node_status)
+            MarkerNode& current_node = node_pool_[current_index];
+            const size_t previous_index = GetChildNodeIndex(parent_index, idx - 1);
+            MarkerNode& previous_node = node_pool_[previous_index];
+            const MarkerExecutionStatus previous_status = GetItemStatus(previous_node);
+
+            if (current_node.child_count != 0 && current_status == MarkerExecutionStatus::kInProgress)
             {
-                previous_node.repeating_same_status_count = current_node.repeating_same_status_count + 1;
+                // Process this node's own sibling list later.
+                pending_parents.push_back(current_index);
             }
-        }
 
-        // Repeating identical nodes needs to be collapsed in a single node appended with a repeat count for marker summary list in text output.
-        // Build the count of consecutive identical nodes and mark the subsequent nodes to be excluded from the summary list text output.
-        if (current_node_status == MarkerExecutionStatus::kInProgress && previous_node_status == MarkerExecutionStatus::kInProgress)
-        {
-            if (previous_node.marker_str == current_node.marker_str)
+            if ((current_status != MarkerExecutionStatus::kInProgress || current_node.child_count == 0)
+                && (previous_status != MarkerExecutionStatus::kInProgress || previous_node.child_count == 0))
             {
-                previous_node.consecutive_identical_nodes_count = current_node.consecutive_identical_nodes_count + 1;
-                current_node.is_include_node_in_text_summary_list = false;
+                if (current_status == previous_status)
+                {
+                    previous_node.repeating_same_status_count = current_node.repeating_same_status_count + 1;
+                }
             }
-        }
-    }
-
-    if (!marker_nodes_.empty() && !marker_nodes_[0].child_markers.empty() && GetItemStatus(marker_nodes_[0]) == MarkerExecutionStatus::kInProgress)
-    {
-        // Update same status marker nodes count for this node.
-        UpdateSameStatusMarkerNodesCountForThisNode(marker_nodes_[0]);
-    }
-
-}
 
-void ExecMarkerTreeSerializer::UpdateSameStatusMarkerNodesCountForThisNode(MarkerNode& current_node)
-{
-    for (intmax_t idx = static_cast<intmax_t>(current_node.child_markers.size()) - 1; idx > 0; idx--)
-    {
-        // Process nodes n - 1 to 1.
-        MarkerNode& current_child_node = current_node.child_markers[idx];
-        MarkerNode& previous_child_node = current_node.child_markers[idx - 1];
-
-        const MarkerExecutionStatus current_child_node_status = GetItemStatus(current_child_node);
-        const MarkerExecutionStatus previous_child_node_status = GetItemStatus(previous_child_node);
-
-        if (!current_child_node.child_markers.empty() && current_child_node_status == MarkerExecutionStatus::kInProgress)
-        {
-            UpdateSameStatusMarkerNodesCountForThisNode(current_child_node);
-        }
-
-        if ((current_child_node_status != MarkerExecutionStatus::kInProgress || current_child_node.child_markers.empty())
-            && (previous_child_node_status != MarkerExecutionStatus::kInProgress || previous_child_node.child_markers.empty()))
-        {
-            if (current_child_node_status == previous_child_node_status)
+            // Repeating identical nodes needs to be collapsed in a single node appended with a repeat count for marker summary list in text output.
+            // Build the count of consecutive identical nodes and mark the subsequent nodes to be excluded from the summary list text output.
+            if (current_status == MarkerExecutionStatus::kInProgress && previous_status == MarkerExecutionStatus::kInProgress)
             {
-                previous_child_node.repeating_same_status_count = current_child_node.repeating_same_status_count + 1;
+                // Interned label ids compare equal exactly when the labels are equal.
+                if (previous_node.marker_str_id == current_node.marker_str_id)
+                {
+                    previous_node.consecutive_identical_nodes_count = current_node.consecutive_identical_nodes_count + 1;
+                    current_node.is_include_node_in_text_summary_list = false;
+                }
             }
+
+            current_index = previous_index;
+            current_status = previous_status;
         }
 
-        // Repeating identical nodes needs to be collapsed in a single node appended with a repeat count for marker summary list in text output.
-        // Build the count of consecutive identical nodes and mark the subsequent nodes to be excluded from the summary list text output.
-        if (current_child_node_status == MarkerExecutionStatus::kInProgress && previous_child_node_status == MarkerExecutionStatus::kInProgress)
+        // First node of the list. The top level list only descends into nodes
+        // that are in progress; nested lists always descend into their first
+        // child, matching the historical traversal so the rendered output is
+        // unchanged.
+        const MarkerNode& first_node = node_pool_[current_index];
+        const bool is_first_node_descended = is_top_level_list
+            ? (first_node.child_count != 0 && current_status == MarkerExecutionStatus::kInProgress)
+            : (first_node.child_count != 0);
+        if (is_first_node_descended)
         {
-            if (previous_child_node.marker_str == current_child_node.marker_str)
-            {
-                previous_child_node.consecutive_identical_nodes_count = current_child_node.consecutive_identical_nodes_count + 1;
-                current_child_node.is_include_node_in_text_summary_list = false;
-            }
+            pending_parents.push_back(current_index);
         }
     }
-
-    if (!current_node.child_markers.empty() && !current_node.child_markers[0].child_markers.empty())
-    {
-        // Process node 0.
-        UpdateSameStatusMarkerNodesCountForThisNode(current_node.child_markers[0]);
-    }
-}
\ No newline at end of file
+}
@@ -16,20 +16,30 @@
 
 // Local.
 #include "rgd_data_types.h"
+#include "rgd_string_pool.h"
 
 // JSON.
 #include "json/single_include/nlohmann/json.hpp"
 
-// Node in the execution marker tree.
+// Index value representing "no node" (e.g. the parent of a top level marker).
+// It is also used to address the implicit root above the top level markers.
+static const size_t kMarkerNodeInvalidIndex = static_cast<size_t>(-1);
+
+// Node in the execution marker tree. All nodes live in the serializer's
+// contiguous node pool and are addressed by pool index, with children stored as
+// an index range into a shared side arena, so growing the tree never moves or
+// deep-copies existing nodes.
 struct MarkerNode
 {
-    MarkerNode(uint64_t begin_timestamp, uint32_t value, const std::string& str) :
-        timestamp_begin_(begin_timestamp), marker_str(str), marker_value(value), marker_info{} {}
+    MarkerNode(uint64_t begin_timestamp, uint32_t value, uint32_t str_id) :
+        timestamp_begin_(begin_timestamp), marker_str_id(str_id), marker_value(value), marker_info{} {}
     uint64_t timestamp_begin_ = 0;
     uint64_t timestamp_end_ = 0;
 
-    // User string.
-    std::string marker_str;
+    // Id of the user string in the serializer's string pool. Marker labels
+    // repeat heavily, so nodes reference the deduplicated pool instead of
+    // owning a copy of the label.
+    uint32_t marker_str_id = 0;
 
     // Marker value.
     uint32_t marker_value = 0;
@@ -42,8 +52,16 @@ struct MarkerNode
     /// (no paddings).
     uint8_t marker_info[MarkerInfoBufferSize] = { 0 };
 
-    // Child markers (markers that started after this marker began and before it ended).
-    std::vector<MarkerNode> child_markers;
+    // Pool index of the parent node (kMarkerNodeInvalidIndex for top level markers).
+    size_t parent_index = kMarkerNodeInvalidIndex;
+
+    // Child markers (markers that started after this marker began and before it
+    // ended) as a contiguous range in the serializer's child index arena:
+    // child_count entries starting at child_begin. The ranges are laid out once
+    // the tree is complete; during construction child_count tracks the number of
+    // children pushed so far.
+    size_t child_begin = 0;
+    size_t child_count = 0;
 
     // Counter to store no of consecutive nodes with same status on its level.
     uint64_t repeating_same_status_count = 0;
@@ -97,11 +115,33 @@ public:
 private:
     const uint64_t kmd_crash_value_begin_ = 0;
     const uint64_t kmd_crash_value_end_ = 0;
-    std::vector<MarkerNode> marker_nodes_;
-    std::vector<MarkerNode*> current_stack_;
+
+    // Contiguous pool holding every node of the tree in event order.
+    std::vector<MarkerNode> node_pool_;
+
+    // Pool indices of the top level markers, in event order.
+    std::vector<size_t> top_level_node_indices_;
+
+    // Shared arena holding each node's children as a contiguous index range.
+    // Laid out by FinalizeTree() once the tree is complete.
+    std::vector<size_t> child_indices_;
+
+    // Pool indices of the markers that began but did not end yet. Indices stay
+    // valid as the pool grows, unlike pointers into a reallocating vector.
+    std::vector<size_t> current_stack_;
+
     std::unordered_map<uint32_t, MarkerExecutionStatus> cmd_buffer_exec_status_;
     std::string missing_markers_info_txt_;
 
+    // Deduplicated marker label storage; nodes reference labels by id. Owned
+    // per tree so that the parallel per command buffer tree build stays
+    // lock-free (labels repeat within a command buffer, so the deduplication
+    // ratio is essentially the same as with one global pool).
+    RgdStringPool string_pool_;
+
+    // True once the child index ranges were laid out.
+    bool is_tree_finalized_ = false;
+
     // True if the text visualization is for a file - we use special characters that
     // render more nicely in files, but are not rendered nicely on Windows console.
     bool is_file_visualization_ = false;
@@ -112,24 +152,36 @@ private:
     void UpdateAndValidateTimestamp(uint64_t timestamp);
 #endif
 
+    // Lay out each node's children as a contiguous range in the child index arena.
+    void FinalizeTree();
+
+    // Return the number of children of the node at the given pool index.
+    // kMarkerNodeInvalidIndex addresses the implicit root above the top level markers.
+    size_t GetChildCount(size_t node_index) const;
+
+    // Return the pool index of the child at the given position under the given node.
+    size_t GetChildNodeIndex(size_t node_index, size_t child_position) const;
+
     // Return the status of the given marker node.
     MarkerExecutionStatus GetItemStatus(const MarkerNode& node) const;
 
-    // Generates a string representation of the execution marker tree.
-    std::string TreeNodeToString(std::vector<bool> is_last_on_level, const MarkerNode& node, const Config& user_config) const;
+    // Return the marker label of the given node, resolved from the string pool.
+    const std::string& GetMarkerString(const MarkerNode& node) const { return string_pool_.GetString(node.marker_str_id); }
+
+    // Appends one line of the tree visualization (prefix glyphs, branch glyph,
+    // status box and marker text) for the given node into the output buffer.
+    void AppendTreeNodeLine(std::string& out, const std::string& prefix, bool is_last_child,
+        bool is_top_level, size_t node_index, const Config& user_config) const;
 
     // Generates a json object for the execution marker tree node.
-    void TreeNodeToJson(const MarkerNode& node, nlohmann::json& marker_node_json, const Config& user_config) const;
+    void TreeNodeToJson(size_t node_index, nlohmann::json& marker_node_json, const Config& user_config) const;
 
     // Generates a summary for markers that are in progress.
-    std::string GenerateSummaryString(std::vector<const MarkerNode*>& node_stack, bool& is_atleast_one_child_in_progress) const;
+    std::string GenerateSummaryString(std::vector<size_t>& node_stack, bool& is_atleast_one_child_in_progress) const;
 
     // Generates a json representation of a summary for markers that are in progress.
-    void GenerateSummaryJson(std::vector<const MarkerNode*>& node_stack,
+    void GenerateSummaryJson(std::vector<size_t>& node_stack,
         nlohmann::json& marker_summary_json, bool& is_atleast_one_child_in_progress) const;
-
-    // Build the look ahead counter of consecutive same status child marker nodes.
-    void UpdateSameStatusMarkerNodesCountForThisNode(MarkerNode& current_node);
 };
 
-#endif // RADEON_GPU_DETECTIVE_EXEC_MARKER_TREE_SERIALIZER_H_
\ No newline at end of file
+#endif // RADEON_GPU_DETECTIVE_EXEC_MARKER_TREE_SERIALIZER_H_
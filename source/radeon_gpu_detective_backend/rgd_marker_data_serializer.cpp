@@ -8,13 +8,18 @@
 // Local.
 #include "rgd_marker_data_serializer.h"
 #include "rgd_exec_marker_tree_serializer.h"
+#include "rgd_thread_pool.h"
 #include "rgd_utils.h"
 
 // C++.
 #include <string>
 #include <sstream>
+#include <atomic>
 #include <cassert>
+#include <future>
 #include <memory>
+#include <thread>
+#include <vector>
 
 // *** INTERNALLY-LINKED AUXILIARY FUNCTIONS - BEGIN ***
 
@@ -32,7 +37,7 @@ static MarkerExecutionStatus MarkerStatusFlagsToExecutionStatus(MarkerExecutionS
 // *** INTERNALLY-LINKED AUXILIARY FUNCTIONS - END ***
 
 bool ExecMarkerDataSerializer::GenerateExecutionMarkerTree(const Config& user_config, const CrashData& umd_crash_data,
-    const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+    const RgdCmdBufferMapping& cmd_buffer_events,
     std::string& marker_tree)
 {
     bool ret = false;
@@ -89,7 +94,7 @@ bool ExecMarkerDataSerializer::GenerateExecutionMarkerTree(const Config& user_co
 }
 
 bool ExecMarkerDataSerializer::GenerateExecutionMarkerTreeToJson(const Config& user_config, const CrashData& umd_crash_data,
-    const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+    const RgdCmdBufferMapping& cmd_buffer_events,
     nlohmann::json& all_cmd_buffers_marker_tree_json)
 {
     bool ret = true;
@@ -122,7 +127,7 @@ bool ExecMarkerDataSerializer::GenerateExecutionMarkerTreeToJson(const Config& u
 }
 
 bool ExecMarkerDataSerializer::GenerateExecutionMarkerSummaryList(const Config& user_config, const CrashData& umd_crash_data,
-    const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+    const RgdCmdBufferMapping& cmd_buffer_events,
     std::string& marker_summary_list_txt)
 {
     bool ret = true;
@@ -163,7 +168,7 @@ bool ExecMarkerDataSerializer::GenerateExecutionMarkerSummaryList(const Config&
 }
 
 bool ExecMarkerDataSerializer::GenerateExecutionMarkerSummaryListJson(const Config& user_config, const CrashData& umd_crash_data,
-    const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+    const RgdCmdBufferMapping& cmd_buffer_events,
     nlohmann::json& marker_summary_list_json)
 {
     bool ret = true;
@@ -187,7 +192,7 @@ bool ExecMarkerDataSerializer::GenerateExecutionMarkerSummaryListJson(const Conf
 }
 
 bool ExecMarkerDataSerializer::BuildCmdBufferMarkerStatus(const CrashData& umd_crash_data,
-    const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events)
+    const RgdCmdBufferMapping& cmd_buffer_events)
 {
     bool ret = true;
 
@@ -204,16 +209,17 @@ bool ExecMarkerDataSerializer::BuildCmdBufferMarkerStatus(const CrashData& umd_c
             // Retrieve the execution markers for the relevant command buffer ID.
             const CrashDebugNopData& debug_nop_event = static_cast<const CrashDebugNopData&>(curr_event);
 
-            if (cmd_buffer_events.find(debug_nop_event.cmdBufferId) != cmd_buffer_events.end()
+            const RgdCmdBufferMapping::Range* cmd_buffer_range = cmd_buffer_events.FindRange(debug_nop_event.cmdBufferId);
+            if (cmd_buffer_range != nullptr
                 && debug_nop_event.beginTimestampValue != InitialExecutionMarkerValue
                 && debug_nop_event.beginTimestampValue != FinalExecutionMarkerValue)
             {
                 // Command buffer mapping is build only for command buffers which are in flight.
                 assert(debug_nop_event.beginTimestampValue == InitialExecutionMarkerValue
                     || debug_nop_event.beginTimestampValue == FinalExecutionMarkerValue
-                    || cmd_buffer_events.find(debug_nop_event.cmdBufferId) != cmd_buffer_events.end());
+                    || cmd_buffer_range != nullptr);
 
-                std::vector<size_t> markers = cmd_buffer_events.at(debug_nop_event.cmdBufferId);
+                const RgdEventIndexSpan markers = cmd_buffer_events.GetSpan(*cmd_buffer_range);
                 std::unordered_map<uint32_t, MarkerExecutionStatusFlags> marker_status;
 
                 // True if we found the marker which is the last to begin/end according to the KMD event data.
@@ -310,10 +316,9 @@ bool ExecMarkerDataSerializer::BuildCmdBufferMarkerStatus(const CrashData& umd_c
 }
 
 bool ExecMarkerDataSerializer::BuildCmdBufferExecutionMarkerTreeNodes(const Config& user_config, const CrashData& umd_crash_data,
-    const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events)
+    const RgdCmdBufferMapping& cmd_buffer_events)
 {
     bool ret = true;
-    bool should_abort = false;
 
     if (command_buffer_marker_status_.empty())
     {
@@ -321,7 +326,11 @@ bool ExecMarkerDataSerializer::BuildCmdBufferExecutionMarkerTreeNodes(const Conf
         assert(ret);
     }
 
-    for (uint32_t i = 0; !should_abort && i < umd_crash_data.events.size(); i++)
+    // Collect the crash debug NOP events that carry marker data for in-flight
+    // command buffers. When a command buffer has more than one debug NOP event,
+    // the last one wins, matching the previous sequential overwrite behavior.
+    std::unordered_map<uint64_t, const CrashDebugNopData*> debug_nop_per_cmd_buffer;
+    for (uint32_t i = 0; i < umd_crash_data.events.size(); i++)
     {
         assert(umd_crash_data.events[i].rgd_event != nullptr);
         const RgdEventOccurrence& curr_event_occurrence = umd_crash_data.events[i];
@@ -329,108 +338,160 @@ bool ExecMarkerDataSerializer::BuildCmdBufferExecutionMarkerTreeNodes(const Conf
         UmdEventId event_id = static_cast<UmdEventId>(curr_event_occurrence.rgd_event->header.eventId);
         if (event_id == UmdEventId::RgdEventCrashDebugNopData)
         {
-            // Retrieve the execution markers for the relevant command buffer ID.
             const CrashDebugNopData& debug_nop_event = static_cast<const CrashDebugNopData&>(curr_event);
 
-            // Retrieve the status map for this command buffer ID.
-            auto cmd_buffer_status_iter = command_buffer_marker_status_.find(debug_nop_event.cmdBufferId);
-
             if (debug_nop_event.beginTimestampValue != InitialExecutionMarkerValue
                 && debug_nop_event.beginTimestampValue != FinalExecutionMarkerValue
-                && cmd_buffer_status_iter != command_buffer_marker_status_.end())
+                && command_buffer_marker_status_.find(debug_nop_event.cmdBufferId) != command_buffer_marker_status_.end())
             {
-                // Command buffer mapping is build only for command buffers which are in flight.
-                assert(debug_nop_event.beginTimestampValue == InitialExecutionMarkerValue
-                    || debug_nop_event.beginTimestampValue == FinalExecutionMarkerValue
-                    || cmd_buffer_status_iter != command_buffer_marker_status_.end());
+                debug_nop_per_cmd_buffer[debug_nop_event.cmdBufferId] = &debug_nop_event;
+            }
+        }
+    }
 
-                std::unordered_map<uint32_t, MarkerExecutionStatus> cmd_buffer_exec_status_map;
-                if (cmd_buffer_status_iter != command_buffer_marker_status_.end())
-                {
-                    cmd_buffer_exec_status_map = cmd_buffer_status_iter->second;
-                }
+    // The tree of each command buffer is built independently of the others, so
+    // the construction, the same-status node counting and the marker validation
+    // run in parallel across command buffers. Each task writes into its own
+    // pre-allocated result slot; the results are merged serially below.
+    struct TreeBuildResult
+    {
+        uint64_t cmd_buffer_id = 0;
+        const CrashDebugNopData* debug_nop_event = nullptr;
+        std::unique_ptr<ExecMarkerTreeSerializer> tree;
+        CmdBufferInfo cmd_buffer_info{};
+        bool is_cmd_buffer_info_found = false;
+    };
+
+    std::vector<TreeBuildResult> results(debug_nop_per_cmd_buffer.size());
+    size_t result_slot = 0;
+    for (const auto& debug_nop_item : debug_nop_per_cmd_buffer)
+    {
+        results[result_slot].cmd_buffer_id = debug_nop_item.first;
+        results[result_slot].debug_nop_event = debug_nop_item.second;
+        ++result_slot;
+    }
 
-                command_buffer_exec_tree_[debug_nop_event.cmdBufferId] = std::make_unique<ExecMarkerTreeSerializer>(user_config, cmd_buffer_exec_status_map,
-                    debug_nop_event.beginTimestampValue, debug_nop_event.endTimestampValue);
+    std::atomic<bool> should_abort{ false };
 
-                auto iter = cmd_buffer_events.find(debug_nop_event.cmdBufferId);
-                assert(iter != cmd_buffer_events.end());
-                if (iter != cmd_buffer_events.end())
-                {
-                    const std::vector<size_t>& cmd_buffer_markers = iter->second;
-                    for (uint32_t m = 0; !should_abort && m < cmd_buffer_markers.size(); m++)
-                    {
-                        const size_t curr_marker_index = cmd_buffer_markers[m];
-                        const RgdEventOccurrence& curr_marker_event = umd_crash_data.events[curr_marker_index];
-                        UmdEventId marker_event_id = static_cast<UmdEventId>(curr_marker_event.rgd_event->header.eventId);
-                        if (marker_event_id == UmdEventId::RgdEventExecutionMarkerBegin)
-                        {
-                            const CrashAnalysisExecutionMarkerBegin& marker_begin =
-                                static_cast<const CrashAnalysisExecutionMarkerBegin&>(*curr_marker_event.rgd_event);
-                            uint32_t marker_value = marker_begin.markerValue;
-                            std::string marker_name = (marker_begin.markerStringSize > 0)
-                                    ? std::string(reinterpret_cast<const char*>(marker_begin.markerName), marker_begin.markerStringSize)
-                                    : std::string(kStrNotAvailable);
-
-                            command_buffer_exec_tree_[debug_nop_event.cmdBufferId]->PushMarkerBegin(curr_marker_event.event_time, marker_value, marker_name);
-                        }
-                        else if (marker_event_id == UmdEventId::RgdEventExecutionMarkerInfo)
-                        {
-                            const CrashAnalysisExecutionMarkerInfo& exec_marker_info_event =
-                                static_cast<const CrashAnalysisExecutionMarkerInfo&>(*curr_marker_event.rgd_event);
-                            uint32_t marker_value = exec_marker_info_event.marker;
-
-                            uint8_t* marker_info = const_cast<uint8_t*>(exec_marker_info_event.markerInfo);
-                            ExecutionMarkerInfoHeader* exec_marker_info_header = reinterpret_cast<ExecutionMarkerInfoHeader*>(marker_info);
+    auto build_tree = [&](TreeBuildResult& result)
+    {
+        const CrashDebugNopData& debug_nop_event = *result.debug_nop_event;
 
-                            if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::CmdBufStart)
-                            {
-                                // Update command buffer info.
-                                CmdBufferInfo* cmd_buffer_info = reinterpret_cast<CmdBufferInfo*>(marker_info + sizeof(ExecutionMarkerInfoHeader));
-                                cmd_buffer_info_map_[debug_nop_event.cmdBufferId] = *cmd_buffer_info;
-                            }
-                            else if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::Draw
-                                || exec_marker_info_header->infoType == ExecutionMarkerInfoType::Dispatch)
-                            {
-                                // Update Draw or Dispatch MarkerNode with additional info.
-                                command_buffer_exec_tree_[debug_nop_event.cmdBufferId]->UpdateMarkerInfo(marker_value, exec_marker_info_event.markerInfo);
-                            }
-                            else if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::BarrierBegin)
-                            {
-                                // Update the Barrier MarkerNode with additional info.
-                                // Currently MarkerNode holds space for one CrashAnalysisExecutionMarkerInfo (marker_info[64]).
-                                // Barrier type marker is the only marker which has two "CrashAnalysisExecutionMarkerInfo" events followed by the CrashAnalysisExecutionMarkerBegin marker.
-                                // These two MarkerInfo event types are - BarrierBegin and BarrierEnd.
-                                // Since information provided with BarrierEnd Info marker is not in use, the available marker_info[64] is used to store the information from BarrierBegin Info marker and BarrierEnd Info marker is ignored.
-                                // If info provided with BarrierEnd is needed in future, update the MarkerNode struct to hold additional marker_info[64] from the BarrierEnd event.
-                                command_buffer_exec_tree_[debug_nop_event.cmdBufferId]->UpdateMarkerInfo(marker_value, exec_marker_info_event.markerInfo);
-                            }
-                        }
-                        else if (marker_event_id == UmdEventId::RgdEventExecutionMarkerEnd)
-                        {
-                            const CrashAnalysisExecutionMarkerEnd& marker_end =
-                                static_cast<const CrashAnalysisExecutionMarkerEnd&>(*curr_marker_event.rgd_event);
-                            uint32_t marker_value = marker_end.markerValue;
+        const RgdCmdBufferMapping::Range* cmd_buffer_range = cmd_buffer_events.FindRange(debug_nop_event.cmdBufferId);
+        assert(cmd_buffer_range != nullptr);
+        if (cmd_buffer_range != nullptr)
+        {
+            result.tree = std::make_unique<ExecMarkerTreeSerializer>(user_config, command_buffer_marker_status_.at(debug_nop_event.cmdBufferId),
+                debug_nop_event.beginTimestampValue, debug_nop_event.endTimestampValue);
+            ExecMarkerTreeSerializer& tree = *result.tree;
 
-                            command_buffer_exec_tree_[debug_nop_event.cmdBufferId]->PushMarkerEnd(curr_marker_event.event_time, marker_value);
-                        }
-                    }
+            const RgdEventIndexSpan cmd_buffer_markers = cmd_buffer_events.GetSpan(*cmd_buffer_range);
+            for (uint32_t m = 0; m < cmd_buffer_markers.size(); m++)
+            {
+                const size_t curr_marker_index = cmd_buffer_markers[m];
+                const RgdEventOccurrence& curr_marker_event = umd_crash_data.events[curr_marker_index];
+                UmdEventId marker_event_id = static_cast<UmdEventId>(curr_marker_event.rgd_event->header.eventId);
+                if (marker_event_id == UmdEventId::RgdEventExecutionMarkerBegin)
+                {
+                    const CrashAnalysisExecutionMarkerBegin& marker_begin =
+                        static_cast<const CrashAnalysisExecutionMarkerBegin&>(*curr_marker_event.rgd_event);
+                    uint32_t marker_value = marker_begin.markerValue;
+                    std::string marker_name = (marker_begin.markerStringSize > 0)
+                            ? std::string(reinterpret_cast<const char*>(marker_begin.markerName), marker_begin.markerStringSize)
+                            : std::string(kStrNotAvailable);
+
+                    tree.PushMarkerBegin(curr_marker_event.event_time, marker_value, marker_name);
+                }
+                else if (marker_event_id == UmdEventId::RgdEventExecutionMarkerInfo)
+                {
+                    const CrashAnalysisExecutionMarkerInfo& exec_marker_info_event =
+                        static_cast<const CrashAnalysisExecutionMarkerInfo&>(*curr_marker_event.rgd_event);
+                    uint32_t marker_value = exec_marker_info_event.marker;
 
-                    // Build the look ahead counter of consecutive same status nodes on the same level.
-                    command_buffer_exec_tree_[debug_nop_event.cmdBufferId]->UpdateSameStatusMarkerNodesCount();
+                    uint8_t* marker_info = const_cast<uint8_t*>(exec_marker_info_event.markerInfo);
+                    ExecutionMarkerInfoHeader* exec_marker_info_header = reinterpret_cast<ExecutionMarkerInfoHeader*>(marker_info);
 
-                    // Validate if any 'Begin' marker is missing  a  matching 'End' marker and report the warnings to the user.
-                    command_buffer_exec_tree_[debug_nop_event.cmdBufferId]->ValidateExecutionMarkers();
+                    if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::CmdBufStart)
+                    {
+                        // Update command buffer info.
+                        CmdBufferInfo* cmd_buffer_info = reinterpret_cast<CmdBufferInfo*>(marker_info + sizeof(ExecutionMarkerInfoHeader));
+                        result.cmd_buffer_info = *cmd_buffer_info;
+                        result.is_cmd_buffer_info_found = true;
+                    }
+                    else if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::Draw
+                        || exec_marker_info_header->infoType == ExecutionMarkerInfoType::Dispatch)
+                    {
+                        // Update Draw or Dispatch MarkerNode with additional info.
+                        tree.UpdateMarkerInfo(marker_value, exec_marker_info_event.markerInfo);
+                    }
+                    else if (exec_marker_info_header->infoType == ExecutionMarkerInfoType::BarrierBegin)
+                    {
+                        // Update the Barrier MarkerNode with additional info.
+                        // Currently MarkerNode holds space for one CrashAnalysisExecutionMarkerInfo (marker_info[64]).
+                        // Barrier type marker is the only marker which has two "CrashAnalysisExecutionMarkerInfo" events followed by the CrashAnalysisExecutionMarkerBegin marker.
+                        // These two MarkerInfo event types are - BarrierBegin and BarrierEnd.
+                        // Since information provided with BarrierEnd Info marker is not in use, the available marker_info[64] is used to store the information from BarrierBegin Info marker and BarrierEnd Info marker is ignored.
+                        // If info provided with BarrierEnd is needed in future, update the MarkerNode struct to hold additional marker_info[64] from the BarrierEnd event.
+                        tree.UpdateMarkerInfo(marker_value, exec_marker_info_event.markerInfo);
+                    }
                 }
-                else
+                else if (marker_event_id == UmdEventId::RgdEventExecutionMarkerEnd)
                 {
-                    should_abort = true;
+                    const CrashAnalysisExecutionMarkerEnd& marker_end =
+                        static_cast<const CrashAnalysisExecutionMarkerEnd&>(*curr_marker_event.rgd_event);
+                    uint32_t marker_value = marker_end.markerValue;
+
+                    tree.PushMarkerEnd(curr_marker_event.event_time, marker_value);
                 }
             }
+
+            // Build the look ahead counter of consecutive same status nodes on the same level.
+            tree.UpdateSameStatusMarkerNodesCount();
+
+            // Validate if any 'Begin' marker is missing  a  matching 'End' marker and report the warnings to the user.
+            tree.ValidateExecutionMarkers();
+        }
+        else
+        {
+            should_abort.store(true);
+        }
+    };
+
+    if (results.size() > 1)
+    {
+        // Note: the status map lookups in the tasks are read-only; the status map
+        // is fully built before the tasks are submitted.
+        RgdThreadPool thread_pool(std::min(results.size(), static_cast<size_t>(std::thread::hardware_concurrency())));
+        std::vector<std::future<void>> build_tasks;
+        build_tasks.reserve(results.size());
+        for (TreeBuildResult& result : results)
+        {
+            build_tasks.push_back(thread_pool.Submit([&build_tree, &result]() { build_tree(result); }));
+        }
+        for (std::future<void>& build_task : build_tasks)
+        {
+            build_task.get();
+        }
+    }
+    else if (!results.empty())
+    {
+        build_tree(results.front());
+    }
+
+    // Merge the per-command buffer results.
+    for (TreeBuildResult& result : results)
+    {
+        if (result.tree != nullptr)
+        {
+            command_buffer_exec_tree_[result.cmd_buffer_id] = std::move(result.tree);
+        }
+        if (result.is_cmd_buffer_info_found)
+        {
+            cmd_buffer_info_map_[result.cmd_buffer_id] = result.cmd_buffer_info;
         }
     }
 
-    if (should_abort)
+    if (should_abort.load())
     {
         ret = false;
     }
@@ -28,35 +28,35 @@ public:
     // cmd_buffer_events maps between each command buffer ID and the indices of its execution marker events.
     // cmd_buffer_marker_status maps between each command buffer ID to a mapping between [marker_value --> execution status].
     bool GenerateExecutionMarkerTree(const Config& user_config, const CrashData& umd_crash_data,
-        const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+        const RgdCmdBufferMapping& cmd_buffer_events,
         std::string& marker_tree);
 
     // Generate a json representation of the status of the execution markers.
     // cmd_buffer_events maps between each command buffer ID and the indices of its execution marker events.
     // cmd_buffer_marker_status maps between each command buffer ID to a mapping between [marker_value --> execution status].
     bool GenerateExecutionMarkerTreeToJson(const Config& user_config, const CrashData& umd_crash_data,
-        const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+        const RgdCmdBufferMapping& cmd_buffer_events,
         nlohmann::json& all_cmd_buffers_marker_tree_json);
 
     // Generate a textual summary of the execution markers.
     bool GenerateExecutionMarkerSummaryList(const Config& user_config, const CrashData& umd_crash_data,
-        const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+        const RgdCmdBufferMapping& cmd_buffer_events,
         std::string& marker_summary_list_txt);
 
     // Generate a json representation of the summary of the execution markers.
     bool GenerateExecutionMarkerSummaryListJson(const Config& user_config, const CrashData& umd_crash_data,
-        const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+        const RgdCmdBufferMapping& cmd_buffer_events,
         nlohmann::json& all_cmd_buffers_marker_summary_json);
 
 private:
 
     // Build command buffer marker status map.
     bool BuildCmdBufferMarkerStatus(const CrashData& umd_crash_data,
-        const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events);
+        const RgdCmdBufferMapping& cmd_buffer_events);
 
     // Build execution marker tree nodes.
     bool BuildCmdBufferExecutionMarkerTreeNodes(const Config& user_config, const CrashData& umd_crash_data,
-        const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events);
+        const RgdCmdBufferMapping& cmd_buffer_events);
 
     // Map to store command buffer id -> marker value -> marker execution status.
     std::unordered_map <uint64_t, std::unordered_map<uint32_t, MarkerExecutionStatus>> command_buffer_marker_status_;
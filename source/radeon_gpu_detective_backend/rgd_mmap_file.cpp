@@ -0,0 +1,136 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  read-only memory-mapped file view for zero-copy RDF streams.
+//=============================================================================
+#include "rgd_mmap_file.h"
+
+// C++.
+#include <cassert>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+RgdMmapFile::~RgdMmapFile()
+{
+    Unmap();
+}
+
+#ifdef _WIN32
+
+bool RgdMmapFile::Map(const std::string& file_path)
+{
+    assert(!IsMapped());
+    bool ret = false;
+
+    HANDLE file_handle = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER file_size{};
+        if (GetFileSizeEx(file_handle, &file_size) && file_size.QuadPart > 0)
+        {
+            HANDLE mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping_handle != nullptr)
+            {
+                const void* data = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+                if (data != nullptr)
+                {
+                    file_handle_ = file_handle;
+                    mapping_handle_ = mapping_handle;
+                    data_ = data;
+                    size_ = static_cast<size_t>(file_size.QuadPart);
+                    ret = true;
+                }
+                else
+                {
+                    CloseHandle(mapping_handle);
+                }
+            }
+        }
+
+        if (!ret)
+        {
+            CloseHandle(file_handle);
+        }
+    }
+
+    return ret;
+}
+
+void RgdMmapFile::Unmap()
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+        data_ = nullptr;
+    }
+    if (mapping_handle_ != nullptr)
+    {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+    if (file_handle_ != nullptr)
+    {
+        CloseHandle(file_handle_);
+        file_handle_ = nullptr;
+    }
+    size_ = 0;
+}
+
+#else
+
+bool RgdMmapFile::Map(const std::string& file_path)
+{
+    assert(!IsMapped());
+    bool ret = false;
+
+    int file_descriptor = open(file_path.c_str(), O_RDONLY);
+    if (file_descriptor >= 0)
+    {
+        struct stat file_info {};
+        if (fstat(file_descriptor, &file_info) == 0 && file_info.st_size > 0)
+        {
+            const void* data = mmap(nullptr, static_cast<size_t>(file_info.st_size),
+                PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+            if (data != MAP_FAILED)
+            {
+                file_descriptor_ = file_descriptor;
+                data_ = data;
+                size_ = static_cast<size_t>(file_info.st_size);
+                ret = true;
+            }
+        }
+
+        if (!ret)
+        {
+            close(file_descriptor);
+        }
+    }
+
+    return ret;
+}
+
+void RgdMmapFile::Unmap()
+{
+    if (data_ != nullptr)
+    {
+        munmap(const_cast<void*>(data_), size_);
+        data_ = nullptr;
+    }
+    if (file_descriptor_ >= 0)
+    {
+        close(file_descriptor_);
+        file_descriptor_ = -1;
+    }
+    size_ = 0;
+}
+
+#endif
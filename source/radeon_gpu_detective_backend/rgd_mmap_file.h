@@ -0,0 +1,56 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  read-only memory-mapped file view for zero-copy RDF streams.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_MMAP_FILE_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_MMAP_FILE_H_
+
+// C++.
+#include <cstddef>
+#include <string>
+
+// Read-only memory mapping of a file on disk. The mapping is shared by all
+// rdf streams created over it, avoiding per-stream file I/O and buffering.
+class RgdMmapFile
+{
+public:
+    RgdMmapFile() = default;
+
+    // Unmaps the file, if mapped.
+    ~RgdMmapFile();
+
+    // Non-copyable: the mapping handle is owned exclusively.
+    RgdMmapFile(const RgdMmapFile&) = delete;
+    RgdMmapFile& operator=(const RgdMmapFile&) = delete;
+
+    // Maps the given file read-only. Returns true on success. On failure the
+    // object stays unmapped and the caller should fall back to regular file I/O.
+    bool Map(const std::string& file_path);
+
+    // Releases the mapping.
+    void Unmap();
+
+    // Returns true when a file is currently mapped.
+    bool IsMapped() const { return data_ != nullptr; }
+
+    // Returns the base address of the mapped view (nullptr when unmapped).
+    const void* GetData() const { return data_; }
+
+    // Returns the size of the mapped file in bytes.
+    size_t GetSize() const { return size_; }
+
+private:
+    const void* data_ = nullptr;
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#else
+    int file_descriptor_ = -1;
+#endif
+};
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_MMAP_FILE_H_
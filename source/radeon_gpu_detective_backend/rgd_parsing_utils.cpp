@@ -8,6 +8,7 @@
 #include "rgd_data_types.h"
 // C++.
 #include <cassert>
+#include <cstring>
 #include <string>
 #include <sstream>
 #include <algorithm>
@@ -17,12 +18,123 @@
 
 // RGD local.
 #include "rgd_utils.h"
+#include "rgd_event_descriptors.h"
 
 // Dev driver.
 #include "dev_driver/include/rgdevents.h"
 #include "rgd_data_types.h"
 
-bool RgdParsingUtils::ParseCrashDataChunks(rdf::ChunkFile& chunk_file, const char* chunk_identifier, CrashData& umd_crash_data, CrashData& kmd_crash_data, std::string& error_msg)
+// *** INTERNALLY-LINKED AUXILIARY FUNCTIONS - BEGIN ***
+
+// Sums the timestamp deltas of the run of consecutive timestamp events starting
+// at byte offset bytes_read, and advances bytes_read past the run. Timestamp
+// events are fixed-size records, so this walks the payload with a constant
+// stride that compilers unroll and vectorize - unlike the variable-length
+// dispatch loop - which matters on dumps where timing ticks dominate the
+// stream with tens of millions of records.
+static uint64_t SumTimestampDeltaRun(const uint8_t* payload, const uint64_t payload_size, uint64_t& bytes_read)
+{
+    uint64_t delta_ticks = 0;
+    while (bytes_read < payload_size)
+    {
+        const TimestampEvent* curr_event = reinterpret_cast<const TimestampEvent*>(payload + bytes_read);
+        if (curr_event->header.eventId != DDCommonEventId::RgdEventTimestamp)
+        {
+            break;
+        }
+        delta_ticks += curr_event->timestamp;
+        bytes_read += sizeof(TimestampEvent);
+    }
+    return delta_ticks;
+}
+
+// Returns an upper bound on the number of events that ParseCrashDataChunks will
+// materialize into CrashData::events for this payload, by walking the event
+// headers only. Events that the parser may later discard (command buffers never
+// seen by the GPU) are included in the count, so the result can slightly
+// over-reserve but never under-reserves.
+static size_t CountMaterializedEvents(const uint8_t* payload, const uint64_t payload_size, const bool is_umd_provider, const bool is_all_events_required)
+{
+    size_t event_count = 0;
+    uint64_t bytes_read = sizeof(DDEventMetaVersion) + sizeof(DDEventProviderHeader);
+
+    while (bytes_read < payload_size)
+    {
+        const RgdEvent* event_header = reinterpret_cast<const RgdEvent*>(payload + bytes_read);
+        if (event_header->header.eventId == DDCommonEventId::RgdEventTimestamp)
+        {
+            // Timestamp ticks are materialized only when the raw event data is
+            // requested. Consume the whole fixed-size run in a tight loop.
+            const uint64_t run_start = bytes_read;
+            do
+            {
+                bytes_read += sizeof(TimestampEvent);
+            } while (bytes_read < payload_size &&
+                     reinterpret_cast<const RgdEvent*>(payload + bytes_read)->header.eventId == DDCommonEventId::RgdEventTimestamp);
+
+            if (is_all_events_required)
+            {
+                event_count += static_cast<size_t>((bytes_read - run_start) / sizeof(TimestampEvent));
+            }
+        }
+        else
+        {
+            const RgdEventDescriptor descriptor = is_umd_provider
+                ? GetUmdEventDescriptor(event_header->header.eventId)
+                : GetKmdEventDescriptor(event_header->header.eventId);
+
+            // Unknown events (no registered descriptor) are skipped by the parser;
+            // every other non-timestamp event is materialized.
+            if (descriptor.name != nullptr)
+            {
+                ++event_count;
+            }
+            bytes_read += GetEventRecordSize(descriptor, event_header->header);
+        }
+    }
+    return event_count;
+}
+
+// Rewrites the chunk payload arena so that it holds only the event records that
+// were materialized into CrashData::events (starting at first_event_index), and
+// rebases the event pointers into the compacted arena. This releases the raw
+// chunk bytes - dominated by timestamp ticks on large dumps - as soon as each
+// chunk is decoded, so the steady-state footprint tracks the retained events
+// rather than the dump size. The retained records keep their stream order, so
+// offsets into the arena (used by the analysis cache) remain stable.
+static void CompactRetainedEvents(CrashData& crash_data, const size_t first_event_index, const bool is_umd_provider)
+{
+    // Sum the retained record sizes first so that the compacted arena is
+    // allocated exactly once and never reallocates while event pointers into
+    // it are being assigned.
+    size_t compacted_size = 0;
+    for (size_t i = first_event_index; i < crash_data.events.size(); ++i)
+    {
+        const RgdEvent& rgd_event = *crash_data.events[i].rgd_event;
+        const RgdEventDescriptor descriptor =
+            is_umd_provider ? GetUmdEventDescriptor(rgd_event.header.eventId) : GetKmdEventDescriptor(rgd_event.header.eventId);
+        compacted_size += GetEventRecordSize(descriptor, rgd_event.header);
+    }
+
+    std::vector<uint8_t> compacted_payload(compacted_size);
+    size_t write_offset = 0;
+    for (size_t i = first_event_index; i < crash_data.events.size(); ++i)
+    {
+        RgdEventOccurrence& curr_event = crash_data.events[i];
+        const RgdEventDescriptor descriptor =
+            is_umd_provider ? GetUmdEventDescriptor(curr_event.rgd_event->header.eventId) : GetKmdEventDescriptor(curr_event.rgd_event->header.eventId);
+        const size_t record_size = GetEventRecordSize(descriptor, curr_event.rgd_event->header);
+        memcpy(compacted_payload.data() + write_offset, curr_event.rgd_event, record_size);
+        curr_event.rgd_event = reinterpret_cast<RgdEvent*>(compacted_payload.data() + write_offset);
+        write_offset += record_size;
+    }
+    crash_data.chunk_payload.swap(compacted_payload);
+}
+
+// *** INTERNALLY-LINKED AUXILIARY FUNCTIONS - END ***
+
+bool RgdParsingUtils::ParseCrashDataChunks(rdf::ChunkFile& chunk_file, const char* chunk_identifier, CrashData& umd_crash_data, CrashData& kmd_crash_data, std::string& error_msg,
+                                           bool is_all_events_required, bool is_bounded_memory)
 {
     bool ret = true;
     std::stringstream error_txt;
@@ -102,8 +214,12 @@ bool RgdParsingUtils::ParseCrashDataChunks(rdf::ChunkFile& chunk_file, const cha
             curr_crash_data.time_info.frequency = frequency;
             curr_crash_data.time_info.start_time = current_time;
 
-            // Read the chunk payload.
-            curr_crash_data.chunk_payload.reserve(payload_size);
+            // Read the chunk payload. The payload buffer doubles as the arena that the
+            // event pointers in CrashData::events reference, so it is sized exactly once
+            // here and never reallocated while the events are alive. Note that resize()
+            // (not reserve()) is required: reading into data() beyond the vector's size
+            // is undefined behavior.
+            curr_crash_data.chunk_payload.resize(payload_size);
             chunk_file.ReadChunkDataToBuffer(chunk_identifier, (int)i, curr_crash_data.chunk_payload.data());
 
             DDEventMetaVersion* meta_version = reinterpret_cast<DDEventMetaVersion*>(curr_crash_data.chunk_payload.data());
@@ -115,6 +231,15 @@ bool RgdParsingUtils::ParseCrashDataChunks(rdf::ChunkFile& chunk_file, const cha
                 break;
             }
 
+            // Size the events vector exactly once with a cheap header-only pre-scan of
+            // the stream, so that materializing millions of entries below never
+            // reallocates. The entries are appended in stream order, which is timestamp
+            // order, so the later linear scans iterate a contiguous, ordered array.
+            const size_t kMaterializedEventCount =
+                CountMaterializedEvents(curr_crash_data.chunk_payload.data(), payload_size, provider_id == kProviderIdUmd, is_all_events_required);
+            const size_t kFirstEventIndex = curr_crash_data.events.size();
+            curr_crash_data.events.reserve(curr_crash_data.events.size() + kMaterializedEventCount);
+
             // Read the event stream.
             uint64_t bytes_read = 0;
 
@@ -133,10 +258,22 @@ bool RgdParsingUtils::ParseCrashDataChunks(rdf::ChunkFile& chunk_file, const cha
 
                 if (event_header->header.eventId == DDCommonEventId::RgdEventTimestamp)
                 {
-                    TimestampEvent* curr_event = reinterpret_cast<TimestampEvent*>(curr_crash_data.chunk_payload.data() + bytes_read);
-                    current_time += (curr_event->timestamp * timeUnit);
-                    curr_crash_data.events.push_back(RgdEventOccurrence(curr_event, current_time));
-                    bytes_read += sizeof(TimestampEvent);
+                    // Timestamp ticks only advance the event clock. They are materialized
+                    // only when the raw event data is requested, since nothing else
+                    // consumes them and on marker-heavy dumps they dominate the stream.
+                    if (is_all_events_required)
+                    {
+                        TimestampEvent* curr_event = reinterpret_cast<TimestampEvent*>(curr_crash_data.chunk_payload.data() + bytes_read);
+                        current_time += (curr_event->timestamp * timeUnit);
+                        curr_crash_data.events.push_back(RgdEventOccurrence(curr_event, current_time));
+                        bytes_read += sizeof(TimestampEvent);
+                    }
+                    else
+                    {
+                        // Consume the whole run of consecutive timestamp events with the
+                        // fixed-stride summation kernel instead of re-dispatching per tick.
+                        current_time += SumTimestampDeltaRun(curr_crash_data.chunk_payload.data(), payload_size, bytes_read) * timeUnit;
+                    }
                 }
                 else if (provider_id == kProviderIdUmd)
                 {
@@ -251,6 +388,13 @@ bool RgdParsingUtils::ParseCrashDataChunks(rdf::ChunkFile& chunk_file, const cha
             {
                 error_txt << " (parsing error - payload size)" << std::endl;
             }
+
+            if (ret && is_bounded_memory)
+            {
+                // Release the raw chunk bytes now that the chunk is decoded,
+                // keeping only the records the analysis consumes.
+                CompactRetainedEvents(curr_crash_data, kFirstEventIndex, provider_id == kProviderIdUmd);
+            }
         }
         else
         {
@@ -282,11 +426,17 @@ bool RgdParsingUtils::ParseCrashDataChunks(rdf::ChunkFile& chunk_file, const cha
     return ret;
 }
 
-bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const CrashData& umd_crash_data, std::unordered_map<uint64_t, std::vector<size_t>>& cmd_buffer_mapping)
+bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const CrashData& umd_crash_data, RgdCmdBufferMapping& cmd_buffer_mapping)
 {
     const uint32_t kApplicationMarkerValueOne = 1;
     bool ret = !umd_crash_data.events.empty();
 
+    // The construction phase needs mutable per-command buffer index lists (internal
+    // barrier 'Begin' events are popped when their 'End' arrives, and a command
+    // buffer is reset when a new crash debug NOP event is seen), so the lists are
+    // built in a map of vectors first and flattened into the mapping at the end.
+    std::unordered_map<uint64_t, std::vector<size_t>> per_cmd_buffer_indices;
+
     // Store command buffer "in-flight" status.
     std::unordered_map<uint32_t, bool> is_command_buffer_in_flight;
 
@@ -309,7 +459,7 @@ bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const
                     if (is_command_buffer_in_flight[cmd_buffer_id])
                     {
                         // Add this marker to the relevant command buffer ID's vector.
-                        cmd_buffer_mapping[cmd_buffer_id].push_back(i);
+                        per_cmd_buffer_indices[cmd_buffer_id].push_back(i);
                     }
                 }
                 else if (exec_marker_begin_event.markerValue == kApplicationMarkerValueOne)
@@ -332,7 +482,7 @@ bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const
                         // Internal driver barrier markers should be filtered out.
                         // First check if an 'End' event is received for an internal barrier marker. If yes, remove the relevant 'Begin' event from the cmd_buffer_mapping.
                         bool is_internal_barrier = false;
-                        size_t previous_event_idx = cmd_buffer_mapping[cmd_buffer_id].back();
+                        size_t previous_event_idx = per_cmd_buffer_indices[cmd_buffer_id].back();
                         const RgdEventOccurrence& previous_event_occurrence = umd_crash_data.events[previous_event_idx];
                         UmdEventId event_id = static_cast<UmdEventId>(previous_event_occurrence.rgd_event->header.eventId);
 
@@ -356,7 +506,7 @@ bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const
                             {
                                 // It is a Barrier Begin marker without intermediate "Info" event. So this is an internal barrier.
                                 // Ignore internal barrier marker events. Remove the 'Begin' event for this internal barrier.
-                                cmd_buffer_mapping[cmd_buffer_id].pop_back();
+                                per_cmd_buffer_indices[cmd_buffer_id].pop_back();
                                 is_internal_barrier = true;
                             }
                         }
@@ -364,7 +514,7 @@ bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const
                         if (!is_internal_barrier)
                         {
                             // Add this marker to the relevant command buffer ID's vector.
-                            cmd_buffer_mapping[cmd_buffer_id].push_back(i);
+                            per_cmd_buffer_indices[cmd_buffer_id].push_back(i);
                         }
                     }
                 }
@@ -379,7 +529,7 @@ bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const
                     if (is_command_buffer_in_flight[cmd_buffer_id])
                     {
                         // Add this marker to the relevant command buffer ID's vector.
-                        cmd_buffer_mapping[cmd_buffer_id].push_back(i);
+                        per_cmd_buffer_indices[cmd_buffer_id].push_back(i);
                     }
                 }
             }
@@ -391,7 +541,7 @@ bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const
                 if (crash_debug_event.beginTimestampValue != InitialExecutionMarkerValue && crash_debug_event.beginTimestampValue != FinalExecutionMarkerValue)
                 {
                     // Reset the command buffer to an initial state
-                    cmd_buffer_mapping[cmd_buffer_id].clear();
+                    per_cmd_buffer_indices[cmd_buffer_id].clear();
 
                     is_command_buffer_in_flight[cmd_buffer_id] = true;
                 }
@@ -404,7 +554,7 @@ bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const
     }
 
     // Sort the execution markers by timestamp.
-    for (auto iter = cmd_buffer_mapping.begin(); iter != cmd_buffer_mapping.end(); iter++)
+    for (auto iter = per_cmd_buffer_indices.begin(); iter != per_cmd_buffer_indices.end(); iter++)
     {
         std::vector<size_t>& markers = iter->second;
         std::stable_sort(markers.begin(), markers.end(), [&](size_t a_index, size_t b_index)
@@ -415,59 +565,31 @@ bool RgdParsingUtils::BuildCommandBufferMapping(const Config& user_config, const
             });
     }
 
+    // Flatten into the contiguous index array + range table representation.
+    cmd_buffer_mapping.Build(per_cmd_buffer_indices);
+
     return ret;
 }
 
 std::string RgdParsingUtils::UmdRgdEventIdToString(uint8_t event_id)
 {
     std::stringstream ret;
-    ret << (uint32_t)event_id << " (";
-    switch (event_id)
-    {
-    case (uint8_t)DDCommonEventId::RgdEventTimestamp:
-        ret << "TIMESTAMP";
-        break;
-    case (uint8_t)UmdEventId::RgdEventExecutionMarkerBegin:
-        ret << "EXEC MARKER BEGIN";
-        break;
-    case (uint8_t)UmdEventId::RgdEventExecutionMarkerInfo:
-        ret << "EXEC MARKER INFO";
-        break;
-    case (uint8_t)UmdEventId::RgdEventExecutionMarkerEnd:
-        ret << "EXEC MARKER END";
-        break;
-    case (uint8_t)UmdEventId::RgdEventCrashDebugNopData:
-        ret << "DEBUG NOP";
-        break;
-    default:
-        // Shouldn't get here.
-        assert(false);
-        ret << kStrNotAvailable;
-        break;
-    }
-    ret << ")";
+    const RgdEventDescriptor descriptor = GetUmdEventDescriptor(event_id);
+
+    // Shouldn't get an unregistered event id here.
+    assert(descriptor.name != nullptr);
+    ret << (uint32_t)event_id << " (" << (descriptor.name != nullptr ? descriptor.name : kStrNotAvailable) << ")";
     return ret.str();
 }
 
 std::string RgdParsingUtils::KmdRgdEventIdToString(uint8_t event_id)
 {
     std::stringstream ret;
-    ret << uint32_t(event_id) << " (";
-    switch (event_id)
-    {
-    case (uint8_t)DDCommonEventId::RgdEventTimestamp:
-        ret << "TIMESTAMP";
-        break;
-    case (uint8_t)KmdEventId::RgdEventVmPageFault:
-        ret << "PAGE FAULT";
-        break;
-    default:
-        // Shouldn't get here.
-        assert(false);
-        ret << kStrNotAvailable;
-        break;
-    }
-    ret << ")";
+    const RgdEventDescriptor descriptor = GetKmdEventDescriptor(event_id);
+
+    // Shouldn't get an unregistered event id here.
+    assert(descriptor.name != nullptr);
+    ret << uint32_t(event_id) << " (" << (descriptor.name != nullptr ? descriptor.name : kStrNotAvailable) << ")";
     return ret.str();
 }
 
@@ -25,12 +25,19 @@ class RgdParsingUtils
 {
 public:
     // Parses a CrashData chunk (either UMD or KMD) from the given chunk file. chunk_identifier is used to identify the chunk.
-    static bool ParseCrashDataChunks(rdf::ChunkFile& chunk_file, const char* chunk_identifier, CrashData& umd_crash_data, CrashData& kmd_crash_data, std::string& error_msg);
+    // When is_all_events_required is false, only the events the analysis consumes (execution markers, crash debug NOP
+    // and page fault events) are materialized; timestamp tick events still advance the event clock but are not stored.
+    // When is_bounded_memory is true, each chunk payload is compacted down to the retained event records after it is
+    // decoded, so the steady-state footprint is proportional to the events the analysis consumes instead of the raw
+    // chunk size (timestamp ticks typically dominate the stream).
+    static bool ParseCrashDataChunks(rdf::ChunkFile& chunk_file, const char* chunk_identifier, CrashData& umd_crash_data, CrashData& kmd_crash_data, std::string& error_msg,
+                                     bool is_all_events_required = true, bool is_bounded_memory = false);
 
     // Builds a mapping between the command buffer ID and the list of execution markers (begin and end) for that
-    // command buffer ID. Execution markers will be sorted chronologically.
+    // command buffer ID. Execution markers will be sorted chronologically. The mapping is flattened into a single
+    // contiguous index array with a per-command buffer range table.
     static bool BuildCommandBufferMapping(const Config& user_config, const CrashData& umd_crash_data,
-                                          std::unordered_map<uint64_t, std::vector<size_t>>& cmd_buffer_mapping);
+                                          RgdCmdBufferMapping& cmd_buffer_mapping);
 
     // Returns a formatted size string for the number of bytes (KB, MB etc.).
     static std::string GetFormattedSizeString(uint64_t size_in_bytes, const char* unit = "B");
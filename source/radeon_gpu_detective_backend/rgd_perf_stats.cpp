@@ -0,0 +1,157 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  per-phase performance statistics collection.
+//=============================================================================
+#include "rgd_perf_stats.h"
+
+// C++.
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// JSON.
+#include "json/single_include/nlohmann/json.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <cstdio>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+// *** INTERNALLY-LINKED AUXILIARY TYPES AND STATE - BEGIN ***
+
+// A single recorded pipeline phase.
+struct RgdPerfPhaseRecord
+{
+    std::string phase_name;
+    uint64_t    duration_ns = 0;
+    uint64_t    rss_end_bytes = 0;
+};
+
+// True while collection is enabled.
+static std::atomic<bool> is_collection_enabled{false};
+
+// Guards the recorded phases: batch mode records phases from worker threads.
+static std::mutex phase_records_mutex;
+
+// The phases recorded so far, in completion order.
+static std::vector<RgdPerfPhaseRecord> phase_records;
+
+// *** INTERNALLY-LINKED AUXILIARY TYPES AND STATE - ENDS ***
+
+void RgdPerfStats::SetEnabled(bool is_enabled)
+{
+    is_collection_enabled.store(is_enabled);
+}
+
+bool RgdPerfStats::IsEnabled()
+{
+    return is_collection_enabled.load();
+}
+
+void RgdPerfStats::RecordPhase(const char* phase_name, uint64_t duration_ns, uint64_t rss_end_bytes)
+{
+    if (IsEnabled())
+    {
+        std::lock_guard<std::mutex> lock(phase_records_mutex);
+        RgdPerfPhaseRecord record;
+        record.phase_name = phase_name;
+        record.duration_ns = duration_ns;
+        record.rss_end_bytes = rss_end_bytes;
+        phase_records.push_back(std::move(record));
+    }
+}
+
+uint64_t RgdPerfStats::GetCurrentRssBytes()
+{
+    uint64_t rss_bytes = 0;
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS memory_counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &memory_counters, sizeof(memory_counters)))
+    {
+        rss_bytes = memory_counters.WorkingSetSize;
+    }
+#else
+    // /proc/self/statm: second field is the resident set size in pages.
+    FILE* statm_file = fopen("/proc/self/statm", "r");
+    if (statm_file != nullptr)
+    {
+        unsigned long long total_pages = 0;
+        unsigned long long resident_pages = 0;
+        if (fscanf(statm_file, "%llu %llu", &total_pages, &resident_pages) == 2)
+        {
+            rss_bytes = resident_pages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        }
+        fclose(statm_file);
+    }
+#endif
+    return rss_bytes;
+}
+
+uint64_t RgdPerfStats::GetPeakRssBytes()
+{
+    uint64_t peak_rss_bytes = 0;
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS memory_counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &memory_counters, sizeof(memory_counters)))
+    {
+        peak_rss_bytes = memory_counters.PeakWorkingSetSize;
+    }
+#else
+    struct rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        // ru_maxrss is reported in kilobytes on Linux.
+        peak_rss_bytes = static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+    }
+#endif
+    return peak_rss_bytes;
+}
+
+void RgdPerfStats::PrintReport()
+{
+    nlohmann::json report_json;
+    nlohmann::json phases_json = nlohmann::json::array();
+
+    {
+        std::lock_guard<std::mutex> lock(phase_records_mutex);
+        for (const RgdPerfPhaseRecord& record : phase_records)
+        {
+            nlohmann::json phase_json;
+            phase_json["phase"] = record.phase_name;
+            phase_json["duration_ms"] = record.duration_ns / 1e6;
+            phase_json["rss_end_bytes"] = record.rss_end_bytes;
+            phases_json.push_back(std::move(phase_json));
+        }
+        phase_records.clear();
+    }
+
+    report_json["rgd_perf_stats"]["phases"] = std::move(phases_json);
+    report_json["rgd_perf_stats"]["peak_rss_bytes"] = GetPeakRssBytes();
+
+    // Single line so that telemetry pipelines can pick it out of the console output.
+    std::cout << report_json.dump() << std::endl;
+}
+
+RgdScopeTimer::RgdScopeTimer(const char* phase_name)
+    : phase_name_(phase_name)
+    , start_time_(std::chrono::steady_clock::now())
+{
+}
+
+RgdScopeTimer::~RgdScopeTimer()
+{
+    if (RgdPerfStats::IsEnabled())
+    {
+        const auto end_time = std::chrono::steady_clock::now();
+        const uint64_t duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time_).count();
+        RgdPerfStats::RecordPhase(phase_name_, duration_ns, RgdPerfStats::GetCurrentRssBytes());
+    }
+}
@@ -0,0 +1,64 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  per-phase performance statistics collection.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_PERF_STATS_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_PERF_STATS_H_
+
+// C++.
+#include <chrono>
+#include <cstdint>
+
+// Collects wall clock timings and process memory counters for the analysis
+// pipeline phases when --perf-stats is specified, and emits the breakdown as
+// machine-readable JSON at the end of the analysis so that telemetry can
+// pinpoint which phase makes a pathological dump slow.
+class RgdPerfStats
+{
+public:
+    // Enables or disables collection. Collection is disabled by default and
+    // recording is a no-op while disabled.
+    static void SetEnabled(bool is_enabled);
+
+    // Returns true when collection is enabled.
+    static bool IsEnabled();
+
+    // Records a completed phase with its duration and the resident set size
+    // sampled at the end of the phase.
+    static void RecordPhase(const char* phase_name, uint64_t duration_ns, uint64_t rss_end_bytes);
+
+    // Returns the current resident set size of the process in bytes, or zero
+    // when the counter is not available on the platform.
+    static uint64_t GetCurrentRssBytes();
+
+    // Returns the peak resident set size of the process in bytes, or zero
+    // when the counter is not available on the platform.
+    static uint64_t GetPeakRssBytes();
+
+    // Prints the recorded phase breakdown as JSON to the console and clears
+    // the recorded phases.
+    static void PrintReport();
+
+private:
+    RgdPerfStats() = delete;
+    ~RgdPerfStats() = delete;
+};
+
+// RAII timer recording the enclosing scope as a phase into RgdPerfStats.
+class RgdScopeTimer
+{
+public:
+    explicit RgdScopeTimer(const char* phase_name);
+    ~RgdScopeTimer();
+
+    RgdScopeTimer(const RgdScopeTimer&) = delete;
+    RgdScopeTimer& operator=(const RgdScopeTimer&) = delete;
+
+private:
+    const char* phase_name_;
+    std::chrono::steady_clock::time_point start_time_;
+};
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_PERF_STATS_H_
@@ -11,12 +11,17 @@
 #include <memory>
 #include <cassert>
 #include <iomanip>
+#include <future>
+#include <mutex>
+#include <thread>
 
 // RGD
 #include "rgd_resource_info_serializer.h"
 #include "rgd_utils.h"
 #include "rgd_parsing_utils.h"
 #include "rgd_data_types.h"
+#include "rgd_thread_pool.h"
+#include "rgd_perf_stats.h"
 
 // RMV
 #include "rmv/source/backend/rmt_memory_event_history.h"
@@ -351,6 +356,13 @@ struct RgdVaInfo
     // Resource create, bind and destroy timeline.
     std::vector<RgdResourceTimeline> rgd_resource_timeline_;
 
+    // Rendered resource history outputs, memoized so that repeated queries for the
+    // same faulting address (e.g. replayed page faults) render exactly once per format.
+    std::string rendered_text_;
+    bool is_text_rendered_ = false;
+    nlohmann::json rendered_json_;
+    bool is_json_rendered_ = false;
+
     // Sort rgd resource timeline.
     void SortResourceTimeline();
 };
@@ -366,6 +378,31 @@ public:
     /// @return true when initializatoin is successful; false otherwise.
     bool InitializeDataSet(const std::string& trace_file_name);
 
+    /// @brief Record the trace file to load the data set from, without loading it yet.
+    ///
+    /// The data set load is deferred until the first virtual address query actually
+    /// needs it, so runs that never touch resource history skip it entirely.
+    ///
+    /// @param [in] trace_file_name The path of the crash dump file.
+    void SetTraceFilePath(const std::string& trace_file_name);
+
+    /// @brief Load the data set recorded by SetTraceFilePath if it is not loaded yet.
+    ///
+    /// @return true when the data set is loaded; false otherwise.
+    bool EnsureDataSetInitialized();
+
+    /// @brief Retrieve the virtual address interval index.
+    ///
+    /// @param [out] out_intervals The sorted, merged address intervals.
+    ///
+    /// @return true when the interval index was built; false otherwise.
+    bool GetVaIntervalIndex(std::vector<RgdVaInterval>& out_intervals) const;
+
+    /// @brief Adopt a previously built virtual address interval index.
+    ///
+    /// @param [in] intervals The sorted, merged address intervals to adopt.
+    void SetVaIntervalIndex(std::vector<RgdVaInterval>&& intervals);
+
     /// @brief Serialize resource info from resource_map_ to string.
     ///
     /// @param [in]  user_config The user configuration.
@@ -374,6 +411,16 @@ public:
     void ResourceHistoryToString(const Config& user_config, const uint64_t virtual_address,
         std::string& resource_info_text);
 
+    /// @brief Serialize a single resource's information block to text.
+    ///
+    /// @param [in]  user_config      The user configuration.
+    /// @param [in]  va_info          The virtual address info holding the resource timeline.
+    /// @param [in]  virtual_address  The Gpu address.
+    /// @param [in]  current_resource The resource to serialize.
+    /// @param [out] txt              The stream receiving the resource block.
+    void SerializeResourceToText(const Config& user_config, const RgdVaInfo& va_info, const uint64_t virtual_address,
+        const RgdResource& current_resource, std::stringstream& txt);
+
     /// @brief Resource history info from resource_map to json.
     ///
     /// @param [in]  user_config The user configuration.
@@ -451,6 +498,20 @@ public:
     std::unordered_map<RmtGpuAddress, std::unique_ptr<RgdVaInfo>> va_info_map_;
 
 private:
+    /// @brief Build the virtual address interval index.
+    ///
+    /// Performs a single pass over the full memory event history and records the
+    /// address ranges of all resource bindings and virtual memory allocations as a
+    /// sorted array of merged intervals. Built once when the data set is initialized.
+    void BuildVaIntervalIndex();
+
+    /// @brief Check if the virtual address falls within any indexed interval.
+    ///
+    /// @param [in] virtual_address The Gpu address.
+    ///
+    /// @return true when the address overlaps a resource binding or allocation range; false otherwise.
+    bool IsVaInAnyInterval(const uint64_t virtual_address) const;
+
     /// @brief Set output format.
     ///
     /// @param [in] user_config The user configuration.
@@ -483,6 +544,22 @@ private:
     bool is_json_required_ = false;
     bool is_raw_time_ = false;
 
+    // Sorted, merged address intervals of all resource bindings and allocations.
+    std::vector<RgdVaInterval> va_interval_index_;
+
+    // True once the interval index was built successfully.
+    bool is_va_interval_index_built_ = false;
+
+    // Path of the crash dump file to load the data set from on first use.
+    std::string trace_file_path_;
+
+    // True once the data set was loaded for trace_file_path_.
+    bool is_data_set_initialized_ = false;
+
+    // Serializes the deferred data set load: an asynchronous preload and the
+    // first virtual address query may race to trigger it.
+    std::mutex data_set_init_mutex_;
+
     // Frequency of timestamps in Rmt data chunk.
     uint64_t cpu_frequency_ = 0;
 };
@@ -559,11 +636,108 @@ bool RgdResourceInfoSerializer::pImplResourceInfoSerializer::InitializeDataSet(c
 
         // Set cpu frequency of the crash analysis session (used for converting raw timestamp to real time).
         SetCpuFrequency(RmtTraceLoaderGetDataSet()->cpu_frequency);
+
+        // Build the interval index once, so that each faulting address query can be
+        // answered with a binary search instead of a full history scan.
+        BuildVaIntervalIndex();
     }
 
     return result;
 }
 
+void RgdResourceInfoSerializer::pImplResourceInfoSerializer::SetTraceFilePath(const std::string& trace_file_name)
+{
+    trace_file_path_ = trace_file_name;
+    is_data_set_initialized_ = false;
+}
+
+bool RgdResourceInfoSerializer::pImplResourceInfoSerializer::EnsureDataSetInitialized()
+{
+    std::lock_guard<std::mutex> data_set_init_lock(data_set_init_mutex_);
+    if (!is_data_set_initialized_ && !trace_file_path_.empty())
+    {
+        RgdScopeTimer rmt_load_timer("rmt_trace_load");
+        is_data_set_initialized_ = InitializeDataSet(trace_file_path_);
+    }
+    return is_data_set_initialized_;
+}
+
+void RgdResourceInfoSerializer::pImplResourceInfoSerializer::BuildVaIntervalIndex()
+{
+    if (is_va_interval_index_built_)
+    {
+        // The index was already built, or restored from the analysis cache.
+        return;
+    }
+    va_interval_index_.clear();
+
+    RmtMemoryEventHistoryHandle history_handle = nullptr;
+    if (RmtMemoryEventHistoryGenerateHistoryForAllResources(RmtTraceLoaderGetDataSet(), &history_handle) == kRmtOk && history_handle != nullptr)
+    {
+        size_t event_count = 0;
+        RmtMemoryEventHistoryGetEventCount(history_handle, &event_count);
+
+        for (RmtMemoryEventHistoryEventIndex index = 0; index < event_count; index++)
+        {
+            RmtResourceHistoryEventType event_type;
+            if (RmtMemoryEventHistoryGetEventType(history_handle, index, &event_type) != kRmtOk)
+            {
+                continue;
+            }
+
+            // Index the address ranges of resource bindings and virtual memory allocations.
+            if (event_type == RmtResourceHistoryEventType::kRmtResourceHistoryEventResourceBound)
+            {
+                const RmtMemoryEventHistoryResourceBindEventInfo* event_info = nullptr;
+                if (RmtMemoryEventHistoryGetResourceBindEventInfo(history_handle, index, &event_info) == kRmtOk
+                    && event_info->size_in_bytes > 0)
+                {
+                    va_interval_index_.push_back({ event_info->virtual_address, event_info->virtual_address + event_info->size_in_bytes });
+                }
+            }
+            else if (event_type == RmtResourceHistoryEventType::kRmtResourceHistoryEventVirtualMemoryAllocated)
+            {
+                const RmtMemoryEventHistoryVirtualMemoryAllocationEventInfo* event_info = nullptr;
+                if (RmtMemoryEventHistoryGetVirtualMemoryAllocationEventInfo(history_handle, index, &event_info) == kRmtOk
+                    && event_info->size_in_bytes > 0)
+                {
+                    va_interval_index_.push_back({ event_info->virtual_address, event_info->virtual_address + event_info->size_in_bytes });
+                }
+            }
+        }
+        RmtMemoryEventHistoryFreeHistory(&history_handle);
+
+        // Sort by interval start and merge overlapping or adjacent intervals so that a
+        // point query is a single binary search over disjoint ranges.
+        std::sort(va_interval_index_.begin(), va_interval_index_.end(),
+            [](const RgdVaInterval& a, const RgdVaInterval& b) { return a.va_start < b.va_start; });
+
+        size_t merged_count = 0;
+        for (size_t index = 0; index < va_interval_index_.size(); index++)
+        {
+            if (merged_count > 0 && va_interval_index_[index].va_start <= va_interval_index_[merged_count - 1].va_end)
+            {
+                va_interval_index_[merged_count - 1].va_end =
+                    std::max(va_interval_index_[merged_count - 1].va_end, va_interval_index_[index].va_end);
+            }
+            else
+            {
+                va_interval_index_[merged_count++] = va_interval_index_[index];
+            }
+        }
+        va_interval_index_.resize(merged_count);
+
+        is_va_interval_index_built_ = true;
+    }
+}
+
+bool RgdResourceInfoSerializer::pImplResourceInfoSerializer::IsVaInAnyInterval(const uint64_t virtual_address) const
+{
+    auto upper_interval = std::upper_bound(va_interval_index_.begin(), va_interval_index_.end(), virtual_address,
+        [](uint64_t va, const RgdVaInterval& interval) { return va < interval.va_start; });
+    return (upper_interval != va_interval_index_.begin()) && (virtual_address < std::prev(upper_interval)->va_end);
+}
+
 RgdResourceInfoSerializer::RgdResourceInfoSerializer()
 {
     resource_info_serializer_impl_ = std::make_unique<pImplResourceInfoSerializer>();
@@ -596,6 +770,15 @@ bool RgdResourceInfoSerializer::pImplResourceInfoSerializer::BuildResourceHistor
     if (result)
     {
         va_info_map_[virtual_address] = std::make_unique<RgdVaInfo>();
+
+        // Fast path: when the interval index proves that no resource binding or allocation
+        // overlaps this address, an empty history is recorded without generating the full
+        // per-address event history.
+        if (virtual_address != kVaReserved && is_va_interval_index_built_ && !IsVaInAnyInterval(virtual_address))
+        {
+            return result;
+        }
+
         RmtMemoryEventHistoryHandle history_handle = nullptr;
         RmtErrorCode is_rmt_result = kRmtOk;
         if (virtual_address != 0)
@@ -655,23 +838,59 @@ uint64_t RgdResourceInfoSerializer::pImplResourceInfoSerializer::GetAllocationOf
     return resource_virtual_address - allocation_base_address;
 }
 
-bool RgdResourceInfoSerializer::InitializeWithTraceFile(const std::string& trace_file_path)
+bool RgdResourceInfoSerializer::pImplResourceInfoSerializer::GetVaIntervalIndex(std::vector<RgdVaInterval>& out_intervals) const
 {
-    bool result = false;
+    if (is_va_interval_index_built_)
+    {
+        out_intervals = va_interval_index_;
+    }
+    return is_va_interval_index_built_;
+}
 
+void RgdResourceInfoSerializer::pImplResourceInfoSerializer::SetVaIntervalIndex(std::vector<RgdVaInterval>&& intervals)
+{
+    va_interval_index_ = std::move(intervals);
+    is_va_interval_index_built_ = true;
+}
+
+bool RgdResourceInfoSerializer::GetVaIntervalIndex(std::vector<RgdVaInterval>& out_intervals) const
+{
+    return resource_info_serializer_impl_->GetVaIntervalIndex(out_intervals);
+}
+
+void RgdResourceInfoSerializer::SetVaIntervalIndex(std::vector<RgdVaInterval>&& intervals)
+{
+    resource_info_serializer_impl_->SetVaIntervalIndex(std::move(intervals));
+}
+
+bool RgdResourceInfoSerializer::InitializeWithTraceFile(const std::string& trace_file_path)
+{
     // Free the existing dataset handle.
     if (RmtTraceLoaderDataSetValid())
     {
         RmtTraceLoaderClearTrace();
     }
-    result = resource_info_serializer_impl_->InitializeDataSet(trace_file_path);
 
-    return result;
+    // Defer the data set load until the first virtual address query needs it.
+    // Runs that never request resource history (e.g. a crash without a page
+    // fault in summary-only mode) skip the load entirely.
+    resource_info_serializer_impl_->SetTraceFilePath(trace_file_path);
+
+    return true;
+}
+
+bool RgdResourceInfoSerializer::PreloadDataSet()
+{
+    return resource_info_serializer_impl_->EnsureDataSetInitialized();
 }
 
 bool RgdResourceInfoSerializer::GetVirtualAddressHistoryInfo(const Config& user_config, const uint64_t virtual_address, nlohmann::json& out_json)
 {
     bool result = false;
+
+    // Load the data set on the first query that needs it.
+    resource_info_serializer_impl_->EnsureDataSetInitialized();
+
     if (resource_info_serializer_impl_->va_info_map_.find(virtual_address) == resource_info_serializer_impl_->va_info_map_.end())
     {
         //Resource history for the VA is not built. Build resource history.
@@ -687,12 +906,30 @@ bool RgdResourceInfoSerializer::GetVirtualAddressHistoryInfo(const Config& user_
     {
         if (resource_info_serializer_impl_->IsJsonRequired())
         {
-            // VA timeline not available for 'all-resources' option.
-            if (user_config.is_va_timeline && virtual_address!= kVaReserved)
+            RgdVaInfo& va_info = *resource_info_serializer_impl_->va_info_map_[virtual_address];
+            if (va_info.is_json_rendered_)
             {
-                out_json[kJsonElemPageFaultSummary]["va_timeline"] = resource_info_serializer_impl_->va_info_map_[virtual_address]->va_residency_json_;
+                // The history for this address was already rendered for an earlier
+                // query (a dump can carry multiple page fault events for the same VA).
+                out_json = va_info.rendered_json_;
+            }
+            else
+            {
+                // VA timeline not available for 'all-resources' option.
+                if (user_config.is_va_timeline && virtual_address!= kVaReserved)
+                {
+                    out_json[kJsonElemPageFaultSummary]["va_timeline"] = va_info.va_residency_json_;
+                }
+                result = resource_info_serializer_impl_->ResourceHistoryToJson(user_config, virtual_address, out_json);
+
+                // Memoize the rendered output per faulting address. The 'all-resources'
+                // report is queried once per run and is skipped to avoid retaining it.
+                if (result && virtual_address != kVaReserved)
+                {
+                    va_info.rendered_json_ = out_json;
+                    va_info.is_json_rendered_ = true;
+                }
             }
-            result = resource_info_serializer_impl_->ResourceHistoryToJson(user_config, virtual_address, out_json);
         }
         else
         {
@@ -706,6 +943,10 @@ bool RgdResourceInfoSerializer::GetVirtualAddressHistoryInfo(const Config& user_
 bool RgdResourceInfoSerializer::GetVirtualAddressHistoryInfo(const Config& user_config, const uint64_t virtual_address, std::string& resource_info_text)
 {
     bool result = false;
+
+    // Load the data set on the first query that needs it.
+    resource_info_serializer_impl_->EnsureDataSetInitialized();
+
     if (resource_info_serializer_impl_->va_info_map_.find(virtual_address) == resource_info_serializer_impl_->va_info_map_.end())
     {
         // Resource history for the VA is not built. Build resource history.
@@ -721,25 +962,43 @@ bool RgdResourceInfoSerializer::GetVirtualAddressHistoryInfo(const Config& user_
     {
         if (resource_info_serializer_impl_->IsTextRequired())
         {
-            // VA timeline not available for 'all-resources' option.
-            if (user_config.is_va_timeline && virtual_address != kVaReserved)
+            RgdVaInfo& va_info = *resource_info_serializer_impl_->va_info_map_[virtual_address];
+            if (va_info.is_text_rendered_)
             {
-
-                // Add virtual address residency timeline to output string.
-                std::stringstream txt;
-                txt << "VA timeline" << std::endl;
-                txt << "===========" << std::endl;
-                txt << resource_info_serializer_impl_->va_info_map_[virtual_address]->va_residency_info_ << std::endl;
-                resource_info_text = txt.str();
+                // The history for this address was already rendered for an earlier
+                // query (a dump can carry multiple page fault events for the same VA).
+                resource_info_text = va_info.rendered_text_;
             }
+            else
+            {
+                // VA timeline not available for 'all-resources' option.
+                if (user_config.is_va_timeline && virtual_address != kVaReserved)
+                {
+
+                    // Add virtual address residency timeline to output string.
+                    std::stringstream txt;
+                    txt << "VA timeline" << std::endl;
+                    txt << "===========" << std::endl;
+                    txt << va_info.va_residency_info_ << std::endl;
+                    resource_info_text = txt.str();
+                }
+
+                // Add resource create, bind and destroy events timeline.
+                std::string resource_timeline;
+                resource_info_serializer_impl_->GenerateResourceTimeline(user_config, virtual_address, resource_timeline);
+                resource_info_text += resource_timeline;
 
-            // Add resource create, bind and destroy events timeline.
-            std::string resource_timeline;
-            resource_info_serializer_impl_->GenerateResourceTimeline(user_config, virtual_address, resource_timeline);
-            resource_info_text += resource_timeline;
+                // Add resource history events info to output string.
+                resource_info_serializer_impl_->ResourceHistoryToString(user_config, virtual_address, resource_info_text);
 
-            // Add resource history events info to output string.
-            resource_info_serializer_impl_->ResourceHistoryToString(user_config, virtual_address, resource_info_text);
+                // Memoize the rendered output per faulting address. The 'all-resources'
+                // report is queried once per run and is skipped to avoid retaining it.
+                if (virtual_address != kVaReserved)
+                {
+                    va_info.rendered_text_ = resource_info_text;
+                    va_info.is_text_rendered_ = true;
+                }
+            }
         }
         else
         {
@@ -1172,10 +1431,6 @@ void RgdResourceInfoSerializer::pImplResourceInfoSerializer::ResourceHistoryToSt
                                                                                      std::string&   out_text)
 {
     std::stringstream txt;
-    const char* kResourceTypeStr = "Type: ";
-    const char* kResourceAttributeStr = "Attributes";
-    const char* kResourceIdStr = "Resource id: ";
-    const char* kNameStr = "Name: ";
     bool              is_no_associated_resources = false;
     
     const RgdVaInfo&  va_info                    = *va_info_map_[virtual_address];
@@ -1210,243 +1465,298 @@ void RgdResourceInfoSerializer::pImplResourceInfoSerializer::ResourceHistoryToSt
         txt << "INFO: no associated resources detected for the offending VA.";
     }
 
-    for(size_t i = 0; i < va_info.resource_list_.size(); ++i)
+    const size_t resource_count = va_info.resource_list_.size();
+    const size_t worker_count   = std::min(resource_count, static_cast<size_t>(std::thread::hardware_concurrency()));
+
+    if (virtual_address == kVaReserved && worker_count > 1)
     {
-        const RgdResource& current_resource = *va_info.resource_list_[i];
+        // With --all-resources the serialized output can cover every resource in the dump, so shard the
+        // resource list across worker threads, each formatting into its own buffer. The shards are
+        // concatenated in list order, so the output is byte-identical to the sequential path.
+        std::vector<std::string>       shard_results(worker_count);
+        std::vector<std::future<void>> serialize_tasks;
+        serialize_tasks.reserve(worker_count);
+        RgdThreadPool thread_pool(worker_count);
+        const size_t  resources_per_shard = (resource_count + worker_count - 1) / worker_count;
+
+        for (size_t shard = 0; shard < worker_count; ++shard)
+        {
+            serialize_tasks.push_back(thread_pool.Submit([&, shard]()
+            {
+                const size_t      begin_index = shard * resources_per_shard;
+                const size_t      end_index   = std::min(begin_index + resources_per_shard, resource_count);
+                std::stringstream shard_txt;
+                for (size_t i = begin_index; i < end_index; ++i)
+                {
+                    SerializeResourceToText(user_config, va_info, virtual_address, *va_info.resource_list_[i], shard_txt);
+                }
+                shard_results[shard] = shard_txt.str();
+            }));
+        }
 
-        // Upon creation of a committed resource an implicit heap is created or upon a creation of a heap an implicit buffer is created.
-        // RGD output will include implicit resource when '--implicit-res' option is used.
-        // associated_resource_idx holds the index of the associated RmtResource and implicit resource pair.
-        
-        if (!current_resource.is_implicit || user_config.is_include_implicit_resources)
+        for (std::future<void>& serialize_task : serialize_tasks)
         {
-            txt << kResourceIdStr << std::hex << "0x" << current_resource.rmv_identifier << std::dec << std::endl;
-            txt << "\t" << kResourceTypeStr << GetResourceTypeText(current_resource.resource_type) << std::endl;
-            txt << "\t" << kNameStr << current_resource.resource_name << std::endl;
-            txt << "\tVirtual address:" << std::endl;
+            serialize_task.get();
+        }
 
-            size_t bind_events_count = 0;
+        for (const std::string& shard_text : shard_results)
+        {
+            txt << shard_text;
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < resource_count; ++i)
+        {
+            SerializeResourceToText(user_config, va_info, virtual_address, *va_info.resource_list_[i], txt);
+        }
+    }
+    txt << std::endl;
+    out_text = txt.str();
+}
 
-            // Iterate through all the bind events and print all the virtual addresses.
-            for (size_t index = 0; index < current_resource.timeline_indices.size(); index++)
-            {
-                const size_t resource_timeline_idx = current_resource.timeline_indices[index];
-                assert(resource_timeline_idx < va_info.rgd_resource_timeline_.size());
-                assert(&va_info.rgd_resource_timeline_[resource_timeline_idx] != nullptr);
-                const RgdResourceTimeline& resource_timeline_event = va_info.rgd_resource_timeline_[resource_timeline_idx];
+// Serialize a single resource's information block to text.
+void RgdResourceInfoSerializer::pImplResourceInfoSerializer::SerializeResourceToText(const Config&      user_config,
+                                                                                     const RgdVaInfo&   va_info,
+                                                                                     const uint64_t     virtual_address,
+                                                                                     const RgdResource& current_resource,
+                                                                                     std::stringstream& txt)
+{
+    const char* kResourceTypeStr = "Type: ";
+    const char* kResourceAttributeStr = "Attributes";
+    const char* kResourceIdStr = "Resource id: ";
+    const char* kNameStr = "Name: ";
 
-                if (resource_timeline_event.event_type == RgdResourceEventType::kBind)
-                {
-                    bind_events_count++;
+    // Upon creation of a committed resource an implicit heap is created or upon a creation of a heap an implicit buffer is created.
+    // RGD output will include implicit resource when '--implicit-res' option is used.
+    // associated_resource_idx holds the index of the associated RmtResource and implicit resource pair.
 
-                    txt << "\t\t 0x" << std::hex << resource_timeline_event.bound_virtual_address
-                        << " [size: " << RgdParsingUtils::GetFormattedSizeString(resource_timeline_event.bound_size_in_bytes)
-                        << ", parent address + offset: 0x" << resource_timeline_event.bound_base_address << " + 0x" << GetAllocationOffset(resource_timeline_event.bound_base_address, resource_timeline_event.bound_virtual_address)
-                        << ", preferred heap: " << ToPreferredHeapString(resource_timeline_event.heap_preferences[0])
-                        << "]" << std::dec;
+    if (!current_resource.is_implicit || user_config.is_include_implicit_resources)
+    {
+        txt << kResourceIdStr << std::hex << "0x" << current_resource.rmv_identifier << std::dec << std::endl;
+        txt << "\t" << kResourceTypeStr << GetResourceTypeText(current_resource.resource_type) << std::endl;
+        txt << "\t" << kNameStr << current_resource.resource_name << std::endl;
+        txt << "\tVirtual address:" << std::endl;
 
-                    if (resource_timeline_event.bound_virtual_address == virtual_address && bind_events_count > 1)
-                    {
-                        // For a resource with multiple bind events, point to a bind event which is specific to offending VA.
-                        txt << "  <-- Offending VA";
-                    }
+        size_t bind_events_count = 0;
 
-                    txt << std::endl;
-                }
-            }
+        // Iterate through all the bind events and print all the virtual addresses.
+        for (size_t index = 0; index < current_resource.timeline_indices.size(); index++)
+        {
+            const size_t resource_timeline_idx = current_resource.timeline_indices[index];
+            assert(resource_timeline_idx < va_info.rgd_resource_timeline_.size());
+            assert(&va_info.rgd_resource_timeline_[resource_timeline_idx] != nullptr);
+            const RgdResourceTimeline& resource_timeline_event = va_info.rgd_resource_timeline_[resource_timeline_idx];
 
-            txt << "\tCommit type: " << GetCommitTypeStringFromCommitType(current_resource.commit_type) << std::endl;
-            if (current_resource.is_implicit)
+            if (resource_timeline_event.event_type == RgdResourceEventType::kBind)
             {
-                txt << "\tImplicit resource: " << "True" << std::endl;
-            }
+                bind_events_count++;
 
-            // Resource Attributes.
-            switch (current_resource.resource_type)
-            {
-            case kRmtResourceTypeBuffer:
-                txt << "\t" << kResourceAttributeStr << " (" << kResourceTypeBufferStr << "):" << std::endl;
-                txt << "\t\tCreate flags: " << GetFlagsString(current_resource.resource_type, current_resource.buffer.create_flags, "create") << std::endl;
-                txt << "\t\tUsage flags: " << GetFlagsString(current_resource.resource_type, current_resource.buffer.usage_flags, "usage") << std::endl;
-                break;
-
-            case kRmtResourceTypeImage:
-                txt << "\t" << kResourceAttributeStr << " (" << kResourceTypeImageStr << "):" << std::endl;
-                txt << "\t\tCreate flags: " << GetFlagsString(current_resource.resource_type, current_resource.image.create_flags, "create") << std::endl;
-                txt << "\t\tUsage flags: " << GetFlagsString(current_resource.resource_type, current_resource.image.usage_flags, "usage") << std::endl;
-                txt << "\t\tImage type: " << GetImageTypeStringFromImageType(current_resource.image.image_type) << std::endl;
-                txt << "\t\tDimensions <x, y, z>: " << current_resource.image.dimension_x << " x " << current_resource.image.dimension_y << " x " << current_resource.image.dimension_z << std::endl;
-                txt << "\t\tSwizzle pattern: " << GetSwizzlePatternString(&current_resource.image.format) << std::endl;
-                txt << "\t\tImage format: " << GetImageFormatString(current_resource.image.format.format) << std::endl;
-                txt << "\t\tMip levels: " << current_resource.image.mip_levels << std::endl;
-                txt << "\t\tSlices: " << current_resource.image.slices << std::endl;
-                txt << "\t\tSample count: " << current_resource.image.sample_count << std::endl;
-                txt << "\t\tFragment count: " << current_resource.image.fragment_count << std::endl;
-                txt << "\t\tTiling type: " << GetImageTypeStringFromImageType(current_resource.image.tiling_type) << std::endl;
-                break;
-
-            case kRmtResourceTypePipeline:
-                txt << "\t" << kResourceAttributeStr << " (" << kResourceTypePipelineStr << "):" << std::endl;
-                txt << "\t" << kResourceTypeStr << kResourceTypePipelineStr << std::endl;
-                txt << "\t\tCreate flags: " << GetFlagsString(current_resource.resource_type, current_resource.pipeline.create_flags) << std::endl;
-                txt << "\t\tInternal pipeline hash - High: 0x" << std::hex << current_resource.pipeline.internal_pipeline_hash_hi << " Low : 0x" << current_resource.pipeline.internal_pipeline_hash_lo << std::dec << std::endl;
-                txt << "\t\tStage mask: 0x" << std::hex << current_resource.pipeline.stage_mask << std::dec << std::endl;
-                txt << "\t\tIs NGG: " << std::boolalpha << current_resource.pipeline.is_ngg << std::noboolalpha << std::endl;
-                break;
-
-            case kRmtResourceTypeCommandAllocator:
-                txt << "\t" << kResourceAttributeStr << " (" << kResourceTypeCommandBufferStr << "):" << std::endl;
-                txt << "\t" << kResourceTypeStr << kResourceTypeCommandBufferStr << std::endl;
-                txt << "\t\tFlags: " << GetFlagsString(current_resource.resource_type, current_resource.command_allocator.flags) << std::endl;
-                txt << "\t\tExecutable preferred heap: " << ToPreferredHeapString(current_resource.command_allocator.cmd_data_heap) << std::endl;
-                txt << "\t\tExecutable size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.cmd_data_size) << std::endl;
-                txt << "\t\tExecutable suballoc size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.cmd_data_suballoc_size) << std::endl;
-                txt << "\t\tEmbedded preferred heap: " << ToPreferredHeapString(current_resource.command_allocator.embed_data_heap) << std::endl;
-                txt << "\t\tEmbedded size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.embed_data_size) << std::endl;
-                txt << "\t\tEmbedded suballoc size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.embed_data_suballoc_size) << std::endl;
-                txt << "\t\tGPU scratch preferred heap: " << ToPreferredHeapString(current_resource.command_allocator.gpu_scratch_heap) << std::endl;
-                txt << "\t\tGPU scratch size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.gpu_scratch_size) << std::endl;
-                txt << "\t\tGPU scratch suballoc size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.gpu_scratch_suballoc_size) << std::endl;
-                break;
-
-            case kRmtResourceTypeHeap:
-                break;
-
-            case kRmtResourceTypeDescriptorHeap:
-            case kRmtResourceTypeDescriptorPool:
-                break;
-
-            case kRmtResourceTypeGpuEvent:
-                txt << "\t" << kResourceAttributeStr << " (" << kResourceTypeGpuEventStr << "):" << std::endl;
-                txt << "\t\tFlags: " << GetFlagsString(current_resource.resource_type, current_resource.gpu_event.flags) << std::endl;
-                break;
-
-            case kRmtResourceTypeBorderColorPalette:
-            case kRmtResourceTypeTimestamp:
-            case kRmtResourceTypeMiscInternal:
-            case kRmtResourceTypePerfExperiment:
-            case kRmtResourceTypeMotionEstimator:
-            case kRmtResourceTypeVideoDecoder:
-            case kRmtResourceTypeVideoEncoder:
-            case kRmtResourceTypeQueryHeap:
-            case kRmtResourceTypeIndirectCmdGenerator:
-                break;
-
-            default:
-                break;
-            }
-            txt << "\tResource timeline:" << std::endl;
-
-            // Print Resource Timeline.
-            //
-            // Build look ahead counter that holds the max count of upcoming events of same type for the respective RgdResourceTimeline event (matched by the index).
-            // This is to collapse repeated events and print the timestamp of first and last event.
-            //
-            // Example:
-            // rgd_resource_timeline = {create, bind, Make Resident, Evict, Make Resident, Evict, Make Resident, Make Resident, Make Resident, Make Resident}
-            // look_ahead_counter    = {     0,    0,             0,     0,             0,     0,             3,             2,             1,             0}
-            //
-            // For 3 or More consecutive events of same type, timestamp of the first and last occurrence will be printed.
-            std::vector<size_t> look_ahead_counter(current_resource.timeline_indices.size(), 0);
-
-            // Do we have repeated events for a table?
-            bool is_repeated_events = false;
-
-            for (intmax_t m = static_cast<intmax_t>(look_ahead_counter.size()) - 1; m > 0; m--)
-            {
-                const size_t current_idx = current_resource.timeline_indices[m];
-                const size_t previous_idx = current_resource.timeline_indices[m - 1];
-                assert(&va_info.rgd_resource_timeline_[current_idx] != nullptr && &va_info.rgd_resource_timeline_[previous_idx] != nullptr);
-                const RgdResourceTimeline& current_event = va_info.rgd_resource_timeline_[current_idx];
-                const RgdResourceTimeline& previous_event = va_info.rgd_resource_timeline_[previous_idx];
-                if (is_repeated_events == false
-                    && current_event.event_type == previous_event.event_type
-                    && current_event.bound_base_address == previous_event.bound_base_address)
+                txt << "\t\t 0x" << std::hex << resource_timeline_event.bound_virtual_address
+                    << " [size: " << RgdParsingUtils::GetFormattedSizeString(resource_timeline_event.bound_size_in_bytes)
+                    << ", parent address + offset: 0x" << resource_timeline_event.bound_base_address << " + 0x" << GetAllocationOffset(resource_timeline_event.bound_base_address, resource_timeline_event.bound_virtual_address)
+                    << ", preferred heap: " << ToPreferredHeapString(resource_timeline_event.heap_preferences[0])
+                    << "]" << std::dec;
+
+                if (resource_timeline_event.bound_virtual_address == virtual_address && bind_events_count > 1)
                 {
-                    look_ahead_counter[m - 1] = look_ahead_counter[m] + 1;
-                    is_repeated_events = (look_ahead_counter[m - 1] > 1) ? true : false;
+                    // For a resource with multiple bind events, point to a bind event which is specific to offending VA.
+                    txt << "  <-- Offending VA";
                 }
+
+                txt << std::endl;
             }
+        }
+
+        txt << "\tCommit type: " << GetCommitTypeStringFromCommitType(current_resource.commit_type) << std::endl;
+        if (current_resource.is_implicit)
+        {
+            txt << "\tImplicit resource: " << "True" << std::endl;
+        }
+
+        // Resource Attributes.
+        switch (current_resource.resource_type)
+        {
+        case kRmtResourceTypeBuffer:
+            txt << "\t" << kResourceAttributeStr << " (" << kResourceTypeBufferStr << "):" << std::endl;
+            txt << "\t\tCreate flags: " << GetFlagsString(current_resource.resource_type, current_resource.buffer.create_flags, "create") << std::endl;
+            txt << "\t\tUsage flags: " << GetFlagsString(current_resource.resource_type, current_resource.buffer.usage_flags, "usage") << std::endl;
+            break;
+
+        case kRmtResourceTypeImage:
+            txt << "\t" << kResourceAttributeStr << " (" << kResourceTypeImageStr << "):" << std::endl;
+            txt << "\t\tCreate flags: " << GetFlagsString(current_resource.resource_type, current_resource.image.create_flags, "create") << std::endl;
+            txt << "\t\tUsage flags: " << GetFlagsString(current_resource.resource_type, current_resource.image.usage_flags, "usage") << std::endl;
+            txt << "\t\tImage type: " << GetImageTypeStringFromImageType(current_resource.image.image_type) << std::endl;
+            txt << "\t\tDimensions <x, y, z>: " << current_resource.image.dimension_x << " x " << current_resource.image.dimension_y << " x " << current_resource.image.dimension_z << std::endl;
+            txt << "\t\tSwizzle pattern: " << GetSwizzlePatternString(&current_resource.image.format) << std::endl;
+            txt << "\t\tImage format: " << GetImageFormatString(current_resource.image.format.format) << std::endl;
+            txt << "\t\tMip levels: " << current_resource.image.mip_levels << std::endl;
+            txt << "\t\tSlices: " << current_resource.image.slices << std::endl;
+            txt << "\t\tSample count: " << current_resource.image.sample_count << std::endl;
+            txt << "\t\tFragment count: " << current_resource.image.fragment_count << std::endl;
+            txt << "\t\tTiling type: " << GetImageTypeStringFromImageType(current_resource.image.tiling_type) << std::endl;
+            break;
+
+        case kRmtResourceTypePipeline:
+            txt << "\t" << kResourceAttributeStr << " (" << kResourceTypePipelineStr << "):" << std::endl;
+            txt << "\t" << kResourceTypeStr << kResourceTypePipelineStr << std::endl;
+            txt << "\t\tCreate flags: " << GetFlagsString(current_resource.resource_type, current_resource.pipeline.create_flags) << std::endl;
+            txt << "\t\tInternal pipeline hash - High: 0x" << std::hex << current_resource.pipeline.internal_pipeline_hash_hi << " Low : 0x" << current_resource.pipeline.internal_pipeline_hash_lo << std::dec << std::endl;
+            txt << "\t\tStage mask: 0x" << std::hex << current_resource.pipeline.stage_mask << std::dec << std::endl;
+            txt << "\t\tIs NGG: " << std::boolalpha << current_resource.pipeline.is_ngg << std::noboolalpha << std::endl;
+            break;
+
+        case kRmtResourceTypeCommandAllocator:
+            txt << "\t" << kResourceAttributeStr << " (" << kResourceTypeCommandBufferStr << "):" << std::endl;
+            txt << "\t" << kResourceTypeStr << kResourceTypeCommandBufferStr << std::endl;
+            txt << "\t\tFlags: " << GetFlagsString(current_resource.resource_type, current_resource.command_allocator.flags) << std::endl;
+            txt << "\t\tExecutable preferred heap: " << ToPreferredHeapString(current_resource.command_allocator.cmd_data_heap) << std::endl;
+            txt << "\t\tExecutable size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.cmd_data_size) << std::endl;
+            txt << "\t\tExecutable suballoc size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.cmd_data_suballoc_size) << std::endl;
+            txt << "\t\tEmbedded preferred heap: " << ToPreferredHeapString(current_resource.command_allocator.embed_data_heap) << std::endl;
+            txt << "\t\tEmbedded size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.embed_data_size) << std::endl;
+            txt << "\t\tEmbedded suballoc size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.embed_data_suballoc_size) << std::endl;
+            txt << "\t\tGPU scratch preferred heap: " << ToPreferredHeapString(current_resource.command_allocator.gpu_scratch_heap) << std::endl;
+            txt << "\t\tGPU scratch size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.gpu_scratch_size) << std::endl;
+            txt << "\t\tGPU scratch suballoc size: " << RgdParsingUtils::GetFormattedSizeString(current_resource.command_allocator.gpu_scratch_suballoc_size) << std::endl;
+            break;
+
+        case kRmtResourceTypeHeap:
+            break;
+
+        case kRmtResourceTypeDescriptorHeap:
+        case kRmtResourceTypeDescriptorPool:
+            break;
+
+        case kRmtResourceTypeGpuEvent:
+            txt << "\t" << kResourceAttributeStr << " (" << kResourceTypeGpuEventStr << "):" << std::endl;
+            txt << "\t\tFlags: " << GetFlagsString(current_resource.resource_type, current_resource.gpu_event.flags) << std::endl;
+            break;
 
-            int timestamp_width = kTimestampWidth;
-            if (is_repeated_events)
+        case kRmtResourceTypeBorderColorPalette:
+        case kRmtResourceTypeTimestamp:
+        case kRmtResourceTypeMiscInternal:
+        case kRmtResourceTypePerfExperiment:
+        case kRmtResourceTypeMotionEstimator:
+        case kRmtResourceTypeVideoDecoder:
+        case kRmtResourceTypeVideoEncoder:
+        case kRmtResourceTypeQueryHeap:
+        case kRmtResourceTypeIndirectCmdGenerator:
+            break;
+
+        default:
+            break;
+        }
+        txt << "\tResource timeline:" << std::endl;
+
+        // Print Resource Timeline.
+        //
+        // Build look ahead counter that holds the max count of upcoming events of same type for the respective RgdResourceTimeline event (matched by the index).
+        // This is to collapse repeated events and print the timestamp of first and last event.
+        //
+        // Example:
+        // rgd_resource_timeline = {create, bind, Make Resident, Evict, Make Resident, Evict, Make Resident, Make Resident, Make Resident, Make Resident}
+        // look_ahead_counter    = {     0,    0,             0,     0,             0,     0,             3,             2,             1,             0}
+        //
+        // For 3 or More consecutive events of same type, timestamp of the first and last occurrence will be printed.
+        std::vector<size_t> look_ahead_counter(current_resource.timeline_indices.size(), 0);
+
+        // Do we have repeated events for a table?
+        bool is_repeated_events = false;
+
+        for (intmax_t m = static_cast<intmax_t>(look_ahead_counter.size()) - 1; m > 0; m--)
+        {
+            const size_t current_idx = current_resource.timeline_indices[m];
+            const size_t previous_idx = current_resource.timeline_indices[m - 1];
+            assert(&va_info.rgd_resource_timeline_[current_idx] != nullptr && &va_info.rgd_resource_timeline_[previous_idx] != nullptr);
+            const RgdResourceTimeline& current_event = va_info.rgd_resource_timeline_[current_idx];
+            const RgdResourceTimeline& previous_event = va_info.rgd_resource_timeline_[previous_idx];
+            if (is_repeated_events == false
+                && current_event.event_type == previous_event.event_type
+                && current_event.bound_base_address == previous_event.bound_base_address)
             {
-                timestamp_width = kTimestampWidth + kTimestampWidth + 1;
+                look_ahead_counter[m - 1] = look_ahead_counter[m] + 1;
+                is_repeated_events = (look_ahead_counter[m - 1] > 1) ? true : false;
             }
+        }
+
+        int timestamp_width = kTimestampWidth;
+        if (is_repeated_events)
+        {
+            timestamp_width = kTimestampWidth + kTimestampWidth + 1;
+        }
+
+        // holds the max count of same type of upcoming events.
+        size_t same_events_count = 0;
 
-            // holds the max count of same type of upcoming events.
-            size_t same_events_count = 0;
+        std::stringstream timestamp_txt;
 
-            std::stringstream timestamp_txt;
+        for (size_t index = 0; index < current_resource.timeline_indices.size(); index++)
+        {
+            const size_t resource_timeline_idx = current_resource.timeline_indices[index];
+            assert(resource_timeline_idx < va_info.rgd_resource_timeline_.size());
+            assert(&va_info.rgd_resource_timeline_[resource_timeline_idx] != nullptr);
+            const RgdResourceTimeline& resource_timeline_event = va_info.rgd_resource_timeline_[resource_timeline_idx];
 
-            for (size_t index = 0; index < current_resource.timeline_indices.size(); index++)
+            if (index == 0 || look_ahead_counter[index - 1] == 0 || same_events_count == 0)
             {
-                const size_t resource_timeline_idx = current_resource.timeline_indices[index];
-                assert(resource_timeline_idx < va_info.rgd_resource_timeline_.size());
-                assert(&va_info.rgd_resource_timeline_[resource_timeline_idx] != nullptr);
-                const RgdResourceTimeline& resource_timeline_event = va_info.rgd_resource_timeline_[resource_timeline_idx];
+                // Set same events count.
+                same_events_count = look_ahead_counter[index];
+                txt << "\t\t";
+                timestamp_txt << GetTimestampString(resource_timeline_event.event_timestamp);
+            }
 
-                if (index == 0 || look_ahead_counter[index - 1] == 0 || same_events_count == 0)
+            if (look_ahead_counter[index] == 0 || same_events_count < kMinEventsToExpand)
+            {
+                if (same_events_count >= kMinEventsToExpand)
                 {
-                    // Set same events count.
-                    same_events_count = look_ahead_counter[index];
-                    txt << "\t\t";
-                    timestamp_txt << GetTimestampString(resource_timeline_event.event_timestamp);
+                    timestamp_txt << ".." << GetTimestampString(resource_timeline_event.event_timestamp);
                 }
+                PrintFormattedResourceTimeline(timestamp_txt.str(), timestamp_width, txt);
 
-                if (look_ahead_counter[index] == 0 || same_events_count < kMinEventsToExpand)
-                {
-                    if (same_events_count >= kMinEventsToExpand)
-                    {
-                        timestamp_txt << ".." << GetTimestampString(resource_timeline_event.event_timestamp);
-                    }
-                    PrintFormattedResourceTimeline(timestamp_txt.str(), timestamp_width, txt);
-
-                    // Clear the timestamp txt stream.
-                    timestamp_txt.str(std::string());
-
-                    switch (resource_timeline_event.event_type)
-                    {
-                    case RgdResourceEventType::kCreate:
-                        txt << ": " << kResourceEventTypeCreateStr;
-                        break;
+                // Clear the timestamp txt stream.
+                timestamp_txt.str(std::string());
 
-                    case RgdResourceEventType::kBind:
-                        txt << ": " << kResourceEventTypeBindStr << " into 0x" << std::hex << resource_timeline_event.bound_virtual_address << std::dec;
-                        break;
+                switch (resource_timeline_event.event_type)
+                {
+                case RgdResourceEventType::kCreate:
+                    txt << ": " << kResourceEventTypeCreateStr;
+                    break;
 
-                    case RgdResourceEventType::kMakeResident:
-                        txt << ": " << kResourceEventTypeMakeResidentStr << " into 0x" << std::hex << resource_timeline_event.bound_virtual_address << std::dec;
-                        break;
+                case RgdResourceEventType::kBind:
+                    txt << ": " << kResourceEventTypeBindStr << " into 0x" << std::hex << resource_timeline_event.bound_virtual_address << std::dec;
+                    break;
 
-                    case RgdResourceEventType::kEvict:
-                        txt << ": " << kResourceEventTypeEvictStr;
-                        break;
+                case RgdResourceEventType::kMakeResident:
+                    txt << ": " << kResourceEventTypeMakeResidentStr << " into 0x" << std::hex << resource_timeline_event.bound_virtual_address << std::dec;
+                    break;
 
-                    case RgdResourceEventType::kDestroy:
-                        txt << ": " << kResourceEventTypeDestroy;
-                        break;
+                case RgdResourceEventType::kEvict:
+                    txt << ": " << kResourceEventTypeEvictStr;
+                    break;
 
-                    default:
-                        // Should not reach here.
-                        assert(false);
-                    }
+                case RgdResourceEventType::kDestroy:
+                    txt << ": " << kResourceEventTypeDestroy;
+                    break;
 
-                    if (same_events_count >= kMinEventsToExpand)
-                    {
-                        txt << " (" << same_events_count + 1 << " occurrences)";
-                    }
-                    txt << std::endl;
+                default:
+                    // Should not reach here.
+                    assert(false);
+                }
 
-                    same_events_count = 0;
+                if (same_events_count >= kMinEventsToExpand)
+                {
+                    txt << " (" << same_events_count + 1 << " occurrences)";
                 }
-            }
+                txt << std::endl;
 
-            txt << std::endl;
+                same_events_count = 0;
+            }
         }
+
+        txt << std::endl;
     }
-    txt << std::endl;
-    out_text = txt.str();
 }
 
 //Format resource history as a json.
@@ -13,6 +13,14 @@
 // JSON.
 #include "json/single_include/nlohmann/json.hpp"
 
+// A half-open address range [va_start, va_end) covered by a resource binding
+// or a virtual memory allocation. Used by the virtual address interval index.
+struct RgdVaInterval
+{
+    uint64_t va_start = 0;
+    uint64_t va_end = 0;
+};
+
 class RgdResourceInfoSerializer
 {
 public:
@@ -48,11 +56,39 @@ public:
 
     /// @brief Initialize resource info serializer handle with the Rmt dataset handle for the input trace file.
     ///
+    /// The Rmt dataset load itself is deferred until the first GetVirtualAddressHistoryInfo
+    /// call, so runs that never query resource history do not pay for it.
+    ///
     /// @param [in] trace_file_path The path of the crash dump file.
     ///
     /// @return true if Rmt dataset handle initialization is successful; false otherwise.
     bool InitializeWithTraceFile(const std::string& trace_file_path);
 
+    /// @brief Load the deferred Rmt data set now.
+    ///
+    /// Used to start the data set load on a worker thread so that it overlaps the
+    /// marker analysis, instead of stalling the first virtual address query. Safe
+    /// to race with a concurrent first query: the load happens exactly once and
+    /// the loser of the race blocks until it is done.
+    ///
+    /// @return true when the data set is loaded; false otherwise.
+    bool PreloadDataSet();
+
+    /// @brief Retrieve the virtual address interval index.
+    ///
+    /// @param [out] out_intervals The sorted, merged address intervals of all resource bindings and allocations.
+    ///
+    /// @return true when the interval index was built; false otherwise.
+    bool GetVaIntervalIndex(std::vector<RgdVaInterval>& out_intervals) const;
+
+    /// @brief Adopt a previously built virtual address interval index.
+    ///
+    /// Used to restore the index from the analysis cache so that initializing the
+    /// data set does not need to regenerate the full memory event history.
+    ///
+    /// @param [in] intervals The sorted, merged address intervals to adopt.
+    void SetVaIntervalIndex(std::vector<RgdVaInterval>&& intervals);
+
 private:
 
     class pImplResourceInfoSerializer;
@@ -9,8 +9,10 @@
 #include "rgd_utils.h"
 #include "rgd_parsing_utils.h"
 #include "rgd_version_info.h"
+#include "rgd_event_descriptors.h"
 
 // C++.
+#include <array>
 #include <string>
 #include <sstream>
 #include <cassert>
@@ -451,81 +453,94 @@ std::string RgdSerializer::EventVmPageFaultToString(const VmPageFaultEvent& page
     return ret.str();
 }
 
-static std::string SerializeRgdEventOccurrenceUmd(const RgdEventOccurrence& curr_event)
+// Formatter rendering a raw event for the crash data dump.
+typedef std::string (*RawEventFormatter)(const RgdEvent& rgd_event, const std::string& offset_tabs);
+
+// Typed adapters feeding the formatter tables below. The tables are indexed by
+// event id like the descriptor tables in rgd_event_descriptors.h, so dispatching
+// an event is a bounds-checked array lookup instead of a switch.
+static std::string FormatTimestampEvent(const RgdEvent& rgd_event, const std::string& offset_tabs)
 {
-    // Serialize the event based on its type.
-    std::stringstream txt;
-    txt << "\tTime: " << curr_event.event_time << std::endl;
-    const RgdEvent& rgd_event = *curr_event.rgd_event;
-    switch (curr_event.rgd_event->header.eventId)
-    {
-    case (uint8_t)DDCommonEventId::RgdEventTimestamp:
-    {
-        const TimestampEvent& timestamp_event = static_cast<const TimestampEvent&>(rgd_event);
-        txt << RgdSerializer::EventTimestampToString(timestamp_event, "\t") << std::endl;
-    }
-    break;
-    case (uint8_t)UmdEventId::RgdEventExecutionMarkerBegin:
-    {
-        const CrashAnalysisExecutionMarkerBegin& exec_marker_begin_event = static_cast<const CrashAnalysisExecutionMarkerBegin&>(rgd_event);
-        txt << RgdSerializer::EventExecMarkerBeginToString(exec_marker_begin_event, "\t") << std::endl;
-    }
-    break;
-    case (uint8_t)UmdEventId::RgdEventExecutionMarkerInfo:
-    {
-        const CrashAnalysisExecutionMarkerInfo& exec_marker_info_event = static_cast<const CrashAnalysisExecutionMarkerInfo&>(rgd_event);
-        txt << RgdSerializer::EventExecMarkerInfoToString(exec_marker_info_event, "\t") << std::endl;
-    }
-    break;
-    case (uint8_t)UmdEventId::RgdEventExecutionMarkerEnd:
-    {
-        const CrashAnalysisExecutionMarkerEnd& exec_marker_end_event = static_cast<const CrashAnalysisExecutionMarkerEnd&>(rgd_event);
-        txt << RgdSerializer::EventExecMarkerEndToString(exec_marker_end_event, "\t") << std::endl;
-    }
-    break;
-    case (uint8_t)UmdEventId::RgdEventCrashDebugNopData:
-    {
-        const CrashDebugNopData& debug_nop_event = static_cast<const CrashDebugNopData&>(rgd_event);
-        txt << RgdSerializer::EventDebugNopToString(debug_nop_event, "\t") << std::endl;
-    }
-    break;
-    break;
-    default:
-        // Notify in case there is an unknown event type.
-        assert(false);
-    }
+    return RgdSerializer::EventTimestampToString(static_cast<const TimestampEvent&>(rgd_event), offset_tabs);
+}
 
-    return txt.str();
+static std::string FormatExecMarkerBeginEvent(const RgdEvent& rgd_event, const std::string& offset_tabs)
+{
+    return RgdSerializer::EventExecMarkerBeginToString(static_cast<const CrashAnalysisExecutionMarkerBegin&>(rgd_event), offset_tabs);
 }
 
-static std::string SerializeRgdEventOccurrenceKmd(const RgdEventOccurrence& curr_event)
+static std::string FormatExecMarkerInfoEvent(const RgdEvent& rgd_event, const std::string& offset_tabs)
+{
+    return RgdSerializer::EventExecMarkerInfoToString(static_cast<const CrashAnalysisExecutionMarkerInfo&>(rgd_event), offset_tabs);
+}
+
+static std::string FormatExecMarkerEndEvent(const RgdEvent& rgd_event, const std::string& offset_tabs)
+{
+    return RgdSerializer::EventExecMarkerEndToString(static_cast<const CrashAnalysisExecutionMarkerEnd&>(rgd_event), offset_tabs);
+}
+
+static std::string FormatDebugNopEvent(const RgdEvent& rgd_event, const std::string& offset_tabs)
+{
+    return RgdSerializer::EventDebugNopToString(static_cast<const CrashDebugNopData&>(rgd_event), offset_tabs);
+}
+
+static std::string FormatVmPageFaultEvent(const RgdEvent& rgd_event, const std::string& offset_tabs)
+{
+    return RgdSerializer::EventVmPageFaultToString(static_cast<const VmPageFaultEvent&>(rgd_event), offset_tabs);
+}
+
+// Formatter table for the UMD provider stream, indexed by event id.
+static constexpr std::array<RawEventFormatter, kEventDescriptorTableSize> BuildUmdRawFormatterTable()
+{
+    std::array<RawEventFormatter, kEventDescriptorTableSize> table{};
+    table[size_t(DDCommonEventId::RgdEventTimestamp)]       = FormatTimestampEvent;
+    table[size_t(UmdEventId::RgdEventExecutionMarkerBegin)] = FormatExecMarkerBeginEvent;
+    table[size_t(UmdEventId::RgdEventExecutionMarkerEnd)]   = FormatExecMarkerEndEvent;
+    table[size_t(UmdEventId::RgdEventCrashDebugNopData)]    = FormatDebugNopEvent;
+    table[size_t(UmdEventId::RgdEventExecutionMarkerInfo)]  = FormatExecMarkerInfoEvent;
+    return table;
+}
+
+// Formatter table for the KMD provider stream, indexed by event id.
+static constexpr std::array<RawEventFormatter, kEventDescriptorTableSize> BuildKmdRawFormatterTable()
+{
+    std::array<RawEventFormatter, kEventDescriptorTableSize> table{};
+    table[size_t(DDCommonEventId::RgdEventTimestamp)] = FormatTimestampEvent;
+    table[size_t(KmdEventId::RgdEventVmPageFault)]    = FormatVmPageFaultEvent;
+    return table;
+}
+
+static constexpr std::array<RawEventFormatter, kEventDescriptorTableSize> kUmdRawFormatters = BuildUmdRawFormatterTable();
+static constexpr std::array<RawEventFormatter, kEventDescriptorTableSize> kKmdRawFormatters = BuildKmdRawFormatterTable();
+
+static std::string SerializeRgdEventOccurrence(const RgdEventOccurrence& curr_event,
+    const std::array<RawEventFormatter, kEventDescriptorTableSize>& formatter_table)
 {
     // Serialize the event based on its type.
     std::stringstream txt;
     txt << "\tTime: " << curr_event.event_time << std::endl;
-    const RgdEvent& rgd_event = *curr_event.rgd_event;
-    switch (curr_event.rgd_event->header.eventId)
-    {
-    case uint8_t(DDCommonEventId::RgdEventTimestamp):
-    {
-        const TimestampEvent& timestamp_event = static_cast<const TimestampEvent&>(rgd_event);
-        txt << RgdSerializer::EventTimestampToString(timestamp_event, "\t") << std::endl;
-    }
-    break;
-    case uint8_t(KmdEventId::RgdEventVmPageFault):
+    const uint8_t event_id = curr_event.rgd_event->header.eventId;
+    const RawEventFormatter formatter = (event_id < formatter_table.size()) ? formatter_table[event_id] : nullptr;
+
+    // Notify in case there is an unknown event type.
+    assert(formatter != nullptr);
+    if (formatter != nullptr)
     {
-        const VmPageFaultEvent& page_fault_event = static_cast<const VmPageFaultEvent&>(rgd_event);
-        txt << RgdSerializer::EventVmPageFaultToString(page_fault_event, "\t") << std::endl;
+        txt << formatter(*curr_event.rgd_event, "\t") << std::endl;
     }
-    break;
-    default:
-        // Notify in case there is an unknown event type.
-        assert(false);
-    }
-
     return txt.str();
 }
 
+static std::string SerializeRgdEventOccurrenceUmd(const RgdEventOccurrence& curr_event)
+{
+    return SerializeRgdEventOccurrence(curr_event, kUmdRawFormatters);
+}
+
+static std::string SerializeRgdEventOccurrenceKmd(const RgdEventOccurrence& curr_event)
+{
+    return SerializeRgdEventOccurrence(curr_event, kKmdRawFormatters);
+}
+
 std::string RgdSerializer::SerializeUmdCrashEvents(const std::vector<RgdEventOccurrence>& umd_events)
 {
     std::stringstream txt;
@@ -14,6 +14,8 @@
 #include <string>
 #include <sstream>
 #include <cassert>
+#include <fstream>
+#include <vector>
 
 // *** INTERNALLY-LINKED AUXILIARY CONSTANTS - BEGIN ***
 
@@ -41,15 +43,31 @@ void RgdSerializerJson::SetInputInfo(const Config&                        user_c
                                      const system_info_utils::SystemInfo& system_info,
                                      const TraceChunkApiInfo&             api_info)
 {
-    json_["crash_analysis_file"]["input_crash_dump_file_name"] = user_config.crash_dump_file;
-    json_["crash_analysis_file"]["input_crash_dump_file_creation_time"] = RgdUtils::GetFileCreationTime(user_config.crash_dump_file);
+    nlohmann::json crash_analysis_file_json;
+    crash_analysis_file_json["input_crash_dump_file_name"] = user_config.crash_dump_file;
+    crash_analysis_file_json["input_crash_dump_file_creation_time"] = RgdUtils::GetFileCreationTime(user_config.crash_dump_file);
     std::string rgd_version_string;
     RgdUtils::TrimLeadingAndTrailingWhitespace(RGD_TITLE, rgd_version_string);
-    json_["crash_analysis_file"]["rgd_cli_version"] = rgd_version_string;
-    json_["crash_analysis_file"]["json_schema_version"] = RGD_JSON_SCHEMA_VERSION;
-    json_["crash_analysis_file"]["crashing_process_id"] = process_info.process_id;
-    json_["crash_analysis_file"]["crashing_process_path"] = (process_info.process_path.empty() ? kStrNotAvailable : process_info.process_path);
-    json_["crash_analysis_file"]["api"] = RgdUtils::GetApiString(api_info.apiType);
+    crash_analysis_file_json["rgd_cli_version"] = rgd_version_string;
+    crash_analysis_file_json["json_schema_version"] = RGD_JSON_SCHEMA_VERSION;
+    crash_analysis_file_json["crashing_process_id"] = process_info.process_id;
+    crash_analysis_file_json["crashing_process_path"] = (process_info.process_path.empty() ? kStrNotAvailable : process_info.process_path);
+    crash_analysis_file_json["api"] = RgdUtils::GetApiString(api_info.apiType);
+
+    // Stream completed top-level sections straight to the output file so the full
+    // document never has to be resident in memory. When the output file cannot be
+    // opened up front, fall back to accumulating the whole document and letting
+    // SaveToFile report the failure. The binary output encodes the complete
+    // document at once, so it requires the accumulating mode.
+    is_streaming_ = !user_config.output_file_json.empty() && user_config.output_file_bin.empty() && stream_writer_.Open(user_config);
+    if (is_streaming_)
+    {
+        stream_writer_.WriteSection("crash_analysis_file", crash_analysis_file_json);
+    }
+    else
+    {
+        json_["crash_analysis_file"] = crash_analysis_file_json;
+    }
 }
 
 void RgdSerializerJson::SetSystemInfoData(const Config& user_config, const system_info_utils::SystemInfo& system_info)
@@ -196,11 +214,13 @@ void RgdSerializerJson::SetSystemInfoData(const Config& user_config, const syste
 void RgdSerializerJson::SetUmdCrashData(const CrashData& umd_crash_data)
 {
     const char* kJsonElemExecMarkers = "execution_markers";
+    const char* kJsonElemDebugNopEvents = "debug_nop_events";
     static const char* kJsonElemMarkerType = "marker_type";
     static const char* kJsonElemMarkerValue = "marker_value";
 
     // Serialize the execution markers.
-    json_[kJsonElemExecMarkers] = nlohmann::json::array();
+    nlohmann::json exec_markers_json = nlohmann::json::array();
+    nlohmann::json debug_nop_events_json;
     for (uint32_t i = 0; i < umd_crash_data.events.size(); i++)
     {
         const RgdEvent& rgd_event = *umd_crash_data.events[i].rgd_event;
@@ -211,7 +231,7 @@ void RgdSerializerJson::SetUmdCrashData(const CrashData& umd_crash_data)
         case uint8_t(UmdEventId::RgdEventExecutionMarkerBegin):
         {
             const CrashAnalysisExecutionMarkerBegin& exec_marker_begin_event = static_cast<const CrashAnalysisExecutionMarkerBegin&>(rgd_event);
-            json_[kJsonElemExecMarkers].push_back({
+            exec_markers_json.push_back({
                 {kJsonElemTimestampElement, umd_crash_data.events[i].event_time},
                 {kJsonElemMarkerType, "begin"},
                 {kJsonElemCmdBufferIdElement, exec_marker_begin_event.cmdBufferId},
@@ -222,7 +242,7 @@ void RgdSerializerJson::SetUmdCrashData(const CrashData& umd_crash_data)
         case uint8_t(UmdEventId::RgdEventExecutionMarkerEnd):
         {
             const CrashAnalysisExecutionMarkerEnd& exec_marker_end_event = static_cast<const CrashAnalysisExecutionMarkerEnd&>(rgd_event);
-            json_[kJsonElemExecMarkers].push_back({
+            exec_markers_json.push_back({
                 {kJsonElemTimestampElement, umd_crash_data.events[i].event_time},
                 {kJsonElemMarkerType, "end"},
                 {kJsonElemCmdBufferIdElement, exec_marker_end_event.cmdBufferId},
@@ -233,7 +253,7 @@ void RgdSerializerJson::SetUmdCrashData(const CrashData& umd_crash_data)
         case uint8_t(UmdEventId::RgdEventCrashDebugNopData):
         {
             const CrashDebugNopData& debug_nop_event = static_cast<const CrashDebugNopData&>(rgd_event);
-            json_["debug_nop_events"].push_back({
+            debug_nop_events_json.push_back({
                 {kJsonElemTimestampElement, umd_crash_data.events[i].event_time},
                 {kJsonElemCmdBufferIdElement, debug_nop_event.cmdBufferId},
                 {"begin_timestamp", debug_nop_event.beginTimestampValue},
@@ -249,10 +269,29 @@ void RgdSerializerJson::SetUmdCrashData(const CrashData& umd_crash_data)
             assert(false);
         }
     }
+
+    if (is_streaming_)
+    {
+        stream_writer_.WriteSection(kJsonElemExecMarkers, exec_markers_json);
+        if (!debug_nop_events_json.is_null())
+        {
+            stream_writer_.WriteSection(kJsonElemDebugNopEvents, debug_nop_events_json);
+        }
+    }
+    else
+    {
+        json_[kJsonElemExecMarkers] = exec_markers_json;
+        if (!debug_nop_events_json.is_null())
+        {
+            json_[kJsonElemDebugNopEvents] = debug_nop_events_json;
+        }
+    }
 }
 
 void RgdSerializerJson::SetKmdCrashData(const CrashData& kmd_crash_data)
 {
+    const char* kJsonElemPageFaultEvents = "page_fault_events";
+    nlohmann::json page_fault_events_json;
     for (uint32_t i = 0; i < kmd_crash_data.events.size(); i++)
     {
         const RgdEvent& rgd_event = *kmd_crash_data.events[i].rgd_event;
@@ -267,7 +306,7 @@ void RgdSerializerJson::SetKmdCrashData(const CrashData& kmd_crash_data)
             {
                 process_name = kStrNotAvailable;
             }
-            json_["page_fault_events"].push_back({
+            page_fault_events_json.push_back({
                 {kJsonElemTimestampElement, kmd_crash_data.events[i].event_time},
                 {"virtual_address", page_fault_event.faultVmAddress},
                 {"process_id", page_fault_event.processId},
@@ -285,6 +324,18 @@ void RgdSerializerJson::SetKmdCrashData(const CrashData& kmd_crash_data)
             assert(false);
         }
     }
+
+    if (!page_fault_events_json.is_null())
+    {
+        if (is_streaming_)
+        {
+            stream_writer_.WriteSection(kJsonElemPageFaultEvents, page_fault_events_json);
+        }
+        else
+        {
+            json_[kJsonElemPageFaultEvents] = page_fault_events_json;
+        }
+    }
 }
 
 void RgdSerializerJson::SetVaResourceData(RgdResourceInfoSerializer& resource_serializer,
@@ -299,13 +350,19 @@ void RgdSerializerJson::SetVaResourceData(RgdResourceInfoSerializer& resource_se
 
     if (is_ok)
     {
-        json_[kJsonElemPageFaultSummary].push_back(resource_info_json[kJsonElemPageFaultSummary]);
-
-        if (!json_[kJsonElemPageFaultSummary].empty())
+        if (is_streaming_)
         {
-            RgdUtils::PrintMessage("JSON representation of the page fault information generated successfully.",
-                RgdMessageType::kInfo, user_config.is_verbose);
+            // Write this resource entry out immediately instead of growing the
+            // page fault summary array in memory.
+            stream_writer_.AppendArrayElement(kJsonElemPageFaultSummary, resource_info_json[kJsonElemPageFaultSummary]);
         }
+        else
+        {
+            json_[kJsonElemPageFaultSummary].push_back(resource_info_json[kJsonElemPageFaultSummary]);
+        }
+
+        RgdUtils::PrintMessage("JSON representation of the page fault information generated successfully.",
+            RgdMessageType::kInfo, user_config.is_verbose);
     }
     else
     {
@@ -314,7 +371,7 @@ void RgdSerializerJson::SetVaResourceData(RgdResourceInfoSerializer& resource_se
 }
 
 void RgdSerializerJson::SetExecutionMarkerTree(const Config& user_config, const CrashData& kmd_crash_data,
-    const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+    const RgdCmdBufferMapping& cmd_buffer_events,
     ExecMarkerDataSerializer& exec_marker_serializer)
 {
     RgdUtils::PrintMessage("generating JSON representation of the execution marker tree...", RgdMessageType::kInfo, user_config.is_verbose);
@@ -331,7 +388,14 @@ void RgdSerializerJson::SetExecutionMarkerTree(const Config& user_config, const
 
     if (is_ok)
     {
-        json_[kJsonElemExecutionMarkerTree] = all_cmd_buffers_marker_tree_json[kJsonElemExecutionMarkerTree];
+        if (is_streaming_)
+        {
+            stream_writer_.WriteSection(kJsonElemExecutionMarkerTree, all_cmd_buffers_marker_tree_json[kJsonElemExecutionMarkerTree]);
+        }
+        else
+        {
+            json_[kJsonElemExecutionMarkerTree] = all_cmd_buffers_marker_tree_json[kJsonElemExecutionMarkerTree];
+        }
 
         if (!all_cmd_buffers_marker_tree_json[kJsonElemExecutionMarkerTree].empty())
         {
@@ -351,7 +415,7 @@ void RgdSerializerJson::SetExecutionMarkerTree(const Config& user_config, const
 }
 
 void RgdSerializerJson::SetExecutionMarkerSummaryList(const Config& user_config, const CrashData& kmd_crash_data,
-    const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+    const RgdCmdBufferMapping& cmd_buffer_events,
     ExecMarkerDataSerializer& exec_marker_serializer)
 {
     RgdUtils::PrintMessage("generating JSON representation of the list of markers in progress...", RgdMessageType::kInfo, user_config.is_verbose);
@@ -365,9 +429,16 @@ void RgdSerializerJson::SetExecutionMarkerSummaryList(const Config& user_config,
 
     if (is_ok)
     {
-        json_[kJsonElemMarkersInProgress] = all_cmd_buffers_exec_marker_summary[kJsonElemMarkersInProgress];
+        if (is_streaming_)
+        {
+            stream_writer_.WriteSection(kJsonElemMarkersInProgress, all_cmd_buffers_exec_marker_summary[kJsonElemMarkersInProgress]);
+        }
+        else
+        {
+            json_[kJsonElemMarkersInProgress] = all_cmd_buffers_exec_marker_summary[kJsonElemMarkersInProgress];
+        }
 
-        if (!json_[kJsonElemMarkersInProgress].empty())
+        if (!all_cmd_buffers_exec_marker_summary[kJsonElemMarkersInProgress].empty())
         {
             RgdUtils::PrintMessage("JSON representation of the list of markers in progress generated successfully.",
                 RgdMessageType::kInfo, user_config.is_verbose);
@@ -466,21 +537,67 @@ void RgdSerializerJson::SetDriverExperimentsInfoData(const nlohmann::json& drive
         error_msg << kErrorMsgFailedToParseDriverExperimentsInfo << " (" << e.what() << ")";
         RgdUtils::PrintMessage(error_msg.str().c_str(), RgdMessageType::kError, true);
     }
-    
+
+    // The driver experiments complete the system info section, so it can now be
+    // written out and released.
+    if (is_streaming_)
+    {
+        stream_writer_.WriteSection(kJsonElemSystemInfo, json_[kJsonElemSystemInfo]);
+        json_.erase(kJsonElemSystemInfo);
+    }
 }
 
-bool RgdSerializerJson::SaveToFile(const Config& user_config) const
+bool RgdSerializerJson::SaveToFile(const Config& user_config)
 {
-    std::string contents;
+    bool ret = true;
 
-    if (user_config.is_compact_json)
+    if (is_streaming_)
     {
-        contents = json_.dump();
+        // Flush any sections that were never completed explicitly (defensive: the
+        // expected call sequence leaves nothing pending) and end the document.
+        for (const auto& section : json_.items())
+        {
+            stream_writer_.WriteSection(section.key(), section.value());
+        }
+        json_.clear();
+        ret = stream_writer_.Close();
     }
-    else
+    else if (!user_config.output_file_json.empty())
     {
-        const int kIndent = 4;
-        contents = json_.dump(kIndent);
+        std::string contents;
+
+        if (user_config.is_compact_json)
+        {
+            contents = json_.dump();
+        }
+        else
+        {
+            const int kIndent = 4;
+            contents = json_.dump(kIndent);
+        }
+        ret = RgdUtils::WriteTextFile(user_config.output_file_json, contents);
     }
-    return RgdUtils::WriteTextFile(user_config.output_file_json, contents);
+
+    if (!user_config.output_file_bin.empty())
+    {
+        // MessagePack encoding of the same document: the sections are identical to
+        // the JSON output, at a fraction of the encode/decode cost and file size.
+        std::ofstream bin_stream(user_config.output_file_bin, std::ios::binary);
+        bool is_bin_written = bin_stream.is_open();
+        assert(is_bin_written);
+        if (is_bin_written)
+        {
+            const std::vector<uint8_t> msgpack_data = nlohmann::json::to_msgpack(json_);
+            bin_stream.write(reinterpret_cast<const char*>(msgpack_data.data()), msgpack_data.size());
+            is_bin_written = bin_stream.good();
+        }
+
+        if (!is_bin_written)
+        {
+            RgdUtils::PrintMessage("failed to write the binary output file.", RgdMessageType::kError, user_config.is_verbose);
+        }
+        ret = is_bin_written && ret;
+    }
+
+    return ret;
 }
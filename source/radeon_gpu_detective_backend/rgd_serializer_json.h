@@ -20,6 +20,7 @@
 #include "rgd_data_types.h"
 #include "rgd_resource_info_serializer.h"
 #include "rgd_marker_data_serializer.h"
+#include "rgd_streaming_json_writer.h"
 
 // JSON Schema version
 #define STRINGIFY_JSON_SCHEMA_VERSION(major, minor) STRINGIFY_MACRO(major) "." STRINGIFY_MACRO(minor)
@@ -61,22 +62,33 @@ public:
 
     // Set command buffer execution markers status tree.
     void SetExecutionMarkerTree(const Config& user_config, const CrashData& kmd_crash_data,
-        const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+        const RgdCmdBufferMapping& cmd_buffer_events,
         ExecMarkerDataSerializer& exec_marker_serializer);
 
     // Set command buffer executiona marker summary list.
     void SetExecutionMarkerSummaryList(const Config& user_config, const CrashData& kmd_crash_data,
-        const std::unordered_map <uint64_t, std::vector<size_t>>& cmd_buffer_events,
+        const RgdCmdBufferMapping& cmd_buffer_events,
         ExecMarkerDataSerializer& exec_marker_serializer);
 
     // Set Driver Experiments info.
     void SetDriverExperimentsInfoData(const nlohmann::json& driver_experiments_json);
 
-    // Saves the JSON contents to a file.
-    bool SaveToFile(const Config& user_config) const;
+    // Completes the output file in streaming mode, or saves the accumulated
+    // JSON contents when streaming is unavailable.
+    bool SaveToFile(const Config& user_config);
 
 private:
+    // Pending sections that are not yet complete (e.g. system info, which is
+    // finalized by the driver experiments), plus the full document when the
+    // streaming writer could not be opened.
     nlohmann::json json_;
+
+    // Streams completed top-level sections straight to the output file so the
+    // full document is never resident in memory.
+    RgdStreamingJsonWriter stream_writer_;
+
+    // True when sections are being streamed to the output file as they complete.
+    bool is_streaming_ = false;
 };
 
 #endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_SERIALIZER_JSON_H_
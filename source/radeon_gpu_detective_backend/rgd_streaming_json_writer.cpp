@@ -0,0 +1,175 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  streaming writer emitting top-level JSON sections to a file.
+//=============================================================================
+#include "rgd_streaming_json_writer.h"
+
+// C++.
+#include <cassert>
+
+// The indentation width used by the pretty output format, matching
+// nlohmann dump(4) which the DOM-based path uses.
+static const int kJsonIndentWidth = 4;
+
+RgdStreamingJsonWriter::~RgdStreamingJsonWriter()
+{
+    if (IsOpen())
+    {
+        Close();
+    }
+}
+
+bool RgdStreamingJsonWriter::Open(const Config& user_config)
+{
+    assert(!IsOpen());
+    is_compact_ = user_config.is_compact_json;
+    is_first_section_ = true;
+    open_array_key_.clear();
+
+    if (RgdZstdOFStream::IsZstdPath(user_config.output_file_json))
+    {
+        // A .zst output path requests transparent zstd compression. Sections
+        // still stream through the compressor one at a time, so peak memory
+        // stays flat while the disk write shrinks.
+        if (zstd_stream_.Open(user_config.output_file_json))
+        {
+            out_ = &zstd_stream_;
+        }
+    }
+    else
+    {
+        file_stream_.open(user_config.output_file_json);
+        if (file_stream_.is_open())
+        {
+            out_ = &file_stream_;
+        }
+    }
+
+    if (IsOpen())
+    {
+        *out_ << "{";
+    }
+    return IsOpen();
+}
+
+void RgdStreamingJsonWriter::WriteSection(const std::string& key, const nlohmann::json& value)
+{
+    assert(IsOpen());
+    if (IsOpen())
+    {
+        EndArraySectionIfOpen();
+        WriteSectionPrefix(key);
+        *out_ << DumpIndented(value, 1);
+    }
+}
+
+void RgdStreamingJsonWriter::AppendArrayElement(const std::string& key, const nlohmann::json& value)
+{
+    assert(IsOpen());
+    if (IsOpen())
+    {
+        if (open_array_key_ != key)
+        {
+            // Start the array section on the first element.
+            EndArraySectionIfOpen();
+            WriteSectionPrefix(key);
+            *out_ << "[";
+            open_array_key_ = key;
+            is_first_array_element_ = true;
+        }
+
+        if (!is_first_array_element_)
+        {
+            *out_ << ",";
+        }
+        if (!is_compact_)
+        {
+            *out_ << "\n" << std::string(2 * kJsonIndentWidth, ' ');
+        }
+        *out_ << DumpIndented(value, 2);
+        is_first_array_element_ = false;
+    }
+}
+
+bool RgdStreamingJsonWriter::Close()
+{
+    assert(IsOpen());
+    bool ret = false;
+    if (IsOpen())
+    {
+        EndArraySectionIfOpen();
+        if (is_compact_ || is_first_section_)
+        {
+            *out_ << "}";
+        }
+        else
+        {
+            *out_ << "\n}";
+        }
+        if (out_ == &zstd_stream_)
+        {
+            ret = zstd_stream_.Close();
+        }
+        else
+        {
+            file_stream_.close();
+            ret = !file_stream_.fail();
+        }
+        out_ = nullptr;
+    }
+    return ret;
+}
+
+void RgdStreamingJsonWriter::WriteSectionPrefix(const std::string& key)
+{
+    if (!is_first_section_)
+    {
+        *out_ << ",";
+    }
+    if (!is_compact_)
+    {
+        *out_ << "\n" << std::string(kJsonIndentWidth, ' ');
+    }
+    *out_ << "\"" << key << "\":" << (is_compact_ ? "" : " ");
+    is_first_section_ = false;
+}
+
+void RgdStreamingJsonWriter::EndArraySectionIfOpen()
+{
+    if (!open_array_key_.empty())
+    {
+        if (is_compact_ || is_first_array_element_)
+        {
+            *out_ << "]";
+        }
+        else
+        {
+            *out_ << "\n" << std::string(kJsonIndentWidth, ' ') << "]";
+        }
+        open_array_key_.clear();
+    }
+}
+
+std::string RgdStreamingJsonWriter::DumpIndented(const nlohmann::json& value, size_t indent_levels) const
+{
+    if (is_compact_)
+    {
+        return value.dump();
+    }
+
+    const std::string padding(indent_levels * kJsonIndentWidth, ' ');
+    const std::string text = value.dump(kJsonIndentWidth);
+    std::string indented_text;
+    indented_text.reserve(text.size() + padding.size() * 8);
+    for (char character : text)
+    {
+        indented_text.push_back(character);
+        if (character == '\n')
+        {
+            indented_text.append(padding);
+        }
+    }
+    return indented_text;
+}
@@ -0,0 +1,76 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  streaming writer emitting top-level JSON sections to a file.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_STREAMING_JSON_WRITER_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_STREAMING_JSON_WRITER_H_
+
+// C++.
+#include <fstream>
+#include <string>
+
+// JSON.
+#include "json/single_include/nlohmann/json.hpp"
+
+// Local.
+#include "rgd_data_types.h"
+#include "rgd_zstd_stream.h"
+
+// Writes a single JSON document to a file one top-level section at a time, so
+// the full output document never has to be resident in memory. Sections are
+// still built as transient nlohmann objects, but each one is written out and
+// released as soon as it is complete. Supports the same compact and
+// 4-space-indented formats as nlohmann dump().
+class RgdStreamingJsonWriter
+{
+public:
+    RgdStreamingJsonWriter() = default;
+
+    // Closes the document if it is still open.
+    ~RgdStreamingJsonWriter();
+
+    // Opens the output file and starts the document. Returns true on success.
+    bool Open(const Config& user_config);
+
+    // Writes "key": <value> as the next top-level section.
+    void WriteSection(const std::string& key, const nlohmann::json& value);
+
+    // Appends an element to the top-level array section with the given key,
+    // starting the array on the first call. The array stays open for further
+    // elements until another section is written or the document is closed.
+    void AppendArrayElement(const std::string& key, const nlohmann::json& value);
+
+    // Ends the document and closes the file. Returns true on success.
+    bool Close();
+
+    // Returns true while the document is open for writing.
+    bool IsOpen() const { return out_ != nullptr; }
+
+private:
+    // Writes the separator and key prefix for the next top-level section.
+    void WriteSectionPrefix(const std::string& key);
+
+    // Closes the currently open array section, if any.
+    void EndArraySectionIfOpen();
+
+    // Returns the value serialized in the configured format, with every line
+    // after the first indented by the given number of 4-space levels.
+    std::string DumpIndented(const nlohmann::json& value, size_t indent_levels) const;
+
+    std::ofstream file_stream_;
+
+    // Compressing variant used when the output path requests zstd (.zst).
+    RgdZstdOFStream zstd_stream_;
+
+    // Points at the active underlying stream while the document is open.
+    std::ostream* out_ = nullptr;
+
+    std::string open_array_key_;
+    bool is_compact_ = false;
+    bool is_first_section_ = true;
+    bool is_first_array_element_ = true;
+};
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_STREAMING_JSON_WRITER_H_
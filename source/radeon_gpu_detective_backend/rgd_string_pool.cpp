@@ -0,0 +1,30 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  interning pool for repeated strings.
+//=============================================================================
+#include "rgd_string_pool.h"
+
+// C++.
+#include <cassert>
+
+uint32_t RgdStringPool::Intern(const std::string& str)
+{
+    const auto it = string_ids_.find(str);
+    if (it != string_ids_.end())
+    {
+        return it->second;
+    }
+
+    const uint32_t string_id = static_cast<uint32_t>(strings_.size());
+    strings_.push_back(str);
+    string_ids_.emplace(str, string_id);
+    return string_id;
+}
+
+const std::string& RgdStringPool::GetString(uint32_t string_id) const
+{
+    assert(string_id < strings_.size());
+    return strings_[string_id];
+}
@@ -0,0 +1,40 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  interning pool for repeated strings.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_STRING_POOL_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_STRING_POOL_H_
+
+// C++.
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A deduplicating string pool. Repeated strings (e.g. marker labels such as
+// "Draw" or "Barrier" that real workloads emit millions of times) are stored
+// once and referenced through a compact 32-bit id, so nodes hold an integer
+// instead of an owned string and equality checks reduce to an id compare.
+class RgdStringPool
+{
+public:
+    // Returns the id of the given string, adding it to the pool on first use.
+    uint32_t Intern(const std::string& str);
+
+    // Returns the string stored for the given id.
+    const std::string& GetString(uint32_t string_id) const;
+
+    // Returns the number of unique strings in the pool.
+    size_t GetStringCount() const { return strings_.size(); }
+
+private:
+    // Unique strings, addressed by id.
+    std::vector<std::string> strings_;
+
+    // Maps each pooled string to its id.
+    std::unordered_map<std::string, uint32_t> string_ids_;
+};
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_STRING_POOL_H_
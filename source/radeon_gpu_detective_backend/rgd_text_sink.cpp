@@ -0,0 +1,84 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  streaming sink for text analysis output.
+//=============================================================================
+#include "rgd_text_sink.h"
+
+// C++.
+#include <iostream>
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS - BEGIN ***
+
+// Size of the file stream buffer. Large enough that section writes coalesce
+// into few storage operations even for reports spanning hundreds of MB.
+static const size_t kFileBufferSize = 1024 * 1024;
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS - ENDS ***
+
+RgdTextSink::RgdTextSink(const std::string& file_path)
+{
+    if (RgdZstdOFStream::IsZstdPath(file_path))
+    {
+        // A .zst output path requests transparent zstd compression. The zstd
+        // stream buffers and compresses in fixed-size chunks on its own.
+        zstd_stream_.Open(file_path);
+        stream_ = &zstd_stream_;
+        is_zstd_backed_ = true;
+    }
+    else if (!file_path.empty())
+    {
+        // The buffer must be installed before the file is opened for pubsetbuf
+        // to take effect portably.
+        file_buffer_.resize(kFileBufferSize);
+        file_stream_.rdbuf()->pubsetbuf(file_buffer_.data(), file_buffer_.size());
+        file_stream_.open(file_path.c_str());
+        stream_ = &file_stream_;
+        is_file_backed_ = true;
+    }
+    else
+    {
+        stream_ = &std::cout;
+    }
+}
+
+RgdTextSink::~RgdTextSink()
+{
+    Flush();
+    if (is_zstd_backed_ && zstd_stream_.IsOpen())
+    {
+        zstd_stream_.Close();
+    }
+    else if (is_file_backed_ && file_stream_.is_open())
+    {
+        file_stream_.close();
+    }
+}
+
+bool RgdTextSink::IsOpen() const
+{
+    bool ret = true;
+    if (is_zstd_backed_)
+    {
+        ret = zstd_stream_.IsOpen();
+    }
+    else if (is_file_backed_)
+    {
+        ret = file_stream_.is_open();
+    }
+    return ret;
+}
+
+std::ostream& RgdTextSink::GetStream()
+{
+    return *stream_;
+}
+
+void RgdTextSink::Flush()
+{
+    if (stream_ != nullptr)
+    {
+        stream_->flush();
+    }
+}
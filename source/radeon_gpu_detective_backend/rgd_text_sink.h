@@ -0,0 +1,53 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  streaming sink for text analysis output.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_TEXT_SINK_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_TEXT_SINK_H_
+
+// C++.
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Local.
+#include "rgd_zstd_stream.h"
+
+// A streaming destination for the text analysis output. When a file path is
+// provided the sink writes through a large file buffer (compressed with zstd
+// when the path ends in .zst); otherwise it writes to the console. Serializers
+// write their sections into the sink incrementally, which bounds peak memory
+// by the largest single section instead of the full report size.
+class RgdTextSink
+{
+public:
+    // Creates the sink. An empty file path selects console output.
+    explicit RgdTextSink(const std::string& file_path);
+
+    // Flushes and closes the underlying stream.
+    ~RgdTextSink();
+
+    // Returns true when the sink is ready to accept output.
+    bool IsOpen() const;
+
+    // Returns the stream to write output into.
+    std::ostream& GetStream();
+
+    // Flushes buffered output to the underlying destination.
+    void Flush();
+
+private:
+    std::vector<char> file_buffer_;
+    std::ofstream     file_stream_;
+
+    // Compressing variant used when the output path requests zstd.
+    RgdZstdOFStream   zstd_stream_;
+    std::ostream*     stream_ = nullptr;
+    bool              is_file_backed_ = false;
+    bool              is_zstd_backed_ = false;
+};
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_TEXT_SINK_H_
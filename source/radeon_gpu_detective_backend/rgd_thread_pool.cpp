@@ -0,0 +1,86 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  thread pool for running independent backend tasks concurrently.
+//=============================================================================
+#include "rgd_thread_pool.h"
+
+// C++.
+#include <cassert>
+
+RgdThreadPool::RgdThreadPool(size_t thread_count)
+{
+    if (thread_count == 0)
+    {
+        thread_count = std::thread::hardware_concurrency();
+
+        // hardware_concurrency() may return zero when it cannot be determined.
+        if (thread_count == 0)
+        {
+            thread_count = 1;
+        }
+    }
+
+    workers_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        workers_.emplace_back(&RgdThreadPool::WorkerLoop, this);
+    }
+}
+
+RgdThreadPool::~RgdThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        is_stopping_ = true;
+    }
+    condition_.notify_all();
+
+    for (std::thread& worker : workers_)
+    {
+        assert(worker.joinable());
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+std::future<void> RgdThreadPool::Submit(std::function<void()> task)
+{
+    std::packaged_task<void()> packaged_task(std::move(task));
+    std::future<void> task_future = packaged_task.get_future();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        assert(!is_stopping_);
+        tasks_.push(std::move(packaged_task));
+    }
+    condition_.notify_one();
+
+    return task_future;
+}
+
+void RgdThreadPool::WorkerLoop()
+{
+    for (;;)
+    {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return is_stopping_ || !tasks_.empty(); });
+            if (tasks_.empty())
+            {
+                // Stop requested and the queue was drained.
+                break;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+
+        // Execute outside the lock. Exceptions are captured by the packaged
+        // task and rethrown to the caller waiting on the future.
+        task();
+    }
+}
@@ -0,0 +1,49 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  thread pool for running independent backend tasks concurrently.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_THREAD_POOL_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_THREAD_POOL_H_
+
+// C++.
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// A fixed-size pool of worker threads executing queued tasks.
+// Used to run independent parsing and serialization stages concurrently.
+class RgdThreadPool
+{
+public:
+    // Creates the pool with the given number of worker threads.
+    // When thread_count is zero, the hardware concurrency is used.
+    explicit RgdThreadPool(size_t thread_count = 0);
+
+    // Stops the workers after draining the task queue.
+    ~RgdThreadPool();
+
+    // Submits a task for asynchronous execution. The returned future is
+    // signaled when the task completes and rethrows any escaped exception.
+    std::future<void> Submit(std::function<void()> task);
+
+    // Returns the number of worker threads in the pool.
+    size_t GetThreadCount() const { return workers_.size(); }
+
+private:
+    // Worker loop: pop and execute tasks until the pool is destroyed.
+    void WorkerLoop();
+
+    std::vector<std::thread> workers_;
+    std::queue<std::packaged_task<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool is_stopping_ = false;
+};
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_THREAD_POOL_H_
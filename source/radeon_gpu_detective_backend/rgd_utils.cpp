@@ -6,6 +6,7 @@
 //=============================================================================
 #include "rgd_utils.h"
 #include "rgd_data_types.h"
+#include "rgd_zstd_stream.h"
 
 // C++.
 #include <cassert>
@@ -34,13 +35,26 @@ bool RgdUtils::IsValidFilePath(const std::string& file_name)
 bool RgdUtils::WriteTextFile(const std::string& file_name, const std::string& contents)
 {
     bool ret = false;
-    std::ofstream output;
-    output.open(file_name.c_str());
-    if (output.is_open())
+    if (RgdZstdOFStream::IsZstdPath(file_name))
     {
-        output << contents << std::endl;
-        output.close();
-        ret = true;
+        // A .zst output path requests transparent zstd compression.
+        RgdZstdOFStream output(file_name);
+        if (output.IsOpen())
+        {
+            output << contents << std::endl;
+            ret = output.Close();
+        }
+    }
+    else
+    {
+        std::ofstream output;
+        output.open(file_name.c_str());
+        if (output.is_open())
+        {
+            output << contents << std::endl;
+            output.close();
+            ret = true;
+        }
     }
     return ret;
 }
@@ -0,0 +1,137 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  zstd-compressed file output stream.
+//=============================================================================
+#include "rgd_zstd_stream.h"
+
+// C++.
+#include <cassert>
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS - BEGIN ***
+
+// File extension requesting transparent zstd compression.
+static const char* kZstdFileExtension = ".zst";
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS - ENDS ***
+
+RgdZstdStreamBuf::~RgdZstdStreamBuf()
+{
+    if (IsOpen())
+    {
+        Close();
+    }
+}
+
+bool RgdZstdStreamBuf::Open(const std::string& file_path)
+{
+    assert(!IsOpen());
+    file_stream_.open(file_path, std::ios::binary);
+    if (file_stream_.is_open())
+    {
+        cctx_ = ZSTD_createCCtx();
+        assert(cctx_ != nullptr);
+        if (cctx_ != nullptr)
+        {
+            // The zstd recommended streaming buffer sizes keep the compressor
+            // on its fast path while bounding the memory footprint.
+            in_buffer_.resize(ZSTD_CStreamInSize());
+            out_buffer_.resize(ZSTD_CStreamOutSize());
+            setp(in_buffer_.data(), in_buffer_.data() + in_buffer_.size());
+        }
+        else
+        {
+            file_stream_.close();
+        }
+    }
+    return IsOpen();
+}
+
+bool RgdZstdStreamBuf::IsOpen() const
+{
+    return file_stream_.is_open() && cctx_ != nullptr;
+}
+
+bool RgdZstdStreamBuf::Close()
+{
+    bool ret = false;
+    if (IsOpen())
+    {
+        ret = CompressPending(true);
+        file_stream_.close();
+        ret = ret && !file_stream_.fail();
+        ZSTD_freeCCtx(cctx_);
+        cctx_ = nullptr;
+        setp(nullptr, nullptr);
+    }
+    return ret;
+}
+
+int RgdZstdStreamBuf::overflow(int ch)
+{
+    if (!IsOpen() || !CompressPending(false))
+    {
+        return traits_type::eof();
+    }
+    if (ch != traits_type::eof())
+    {
+        *pptr() = static_cast<char>(ch);
+        pbump(1);
+    }
+    return ch;
+}
+
+int RgdZstdStreamBuf::sync()
+{
+    int ret = -1;
+    if (IsOpen() && CompressPending(false))
+    {
+        file_stream_.flush();
+        ret = file_stream_.good() ? 0 : -1;
+    }
+    return ret;
+}
+
+bool RgdZstdStreamBuf::CompressPending(bool is_end_of_frame)
+{
+    bool ret = true;
+
+    ZSTD_inBuffer input{ pbase(), static_cast<size_t>(pptr() - pbase()), 0 };
+    const ZSTD_EndDirective end_directive = is_end_of_frame ? ZSTD_e_end : ZSTD_e_continue;
+
+    bool is_done = false;
+    while (ret && !is_done)
+    {
+        ZSTD_outBuffer output{ out_buffer_.data(), out_buffer_.size(), 0 };
+        const size_t remaining = ZSTD_compressStream2(cctx_, &output, &input, end_directive);
+        if (ZSTD_isError(remaining))
+        {
+            assert(false);
+            ret = false;
+        }
+        else
+        {
+            file_stream_.write(out_buffer_.data(), output.pos);
+            ret = file_stream_.good();
+
+            // Continue until the input is consumed, and for the final block
+            // until the frame epilogue is fully flushed as well.
+            is_done = (input.pos == input.size) && (!is_end_of_frame || remaining == 0);
+        }
+    }
+
+    if (ret)
+    {
+        // The pending input was consumed: recycle the put area.
+        setp(in_buffer_.data(), in_buffer_.data() + in_buffer_.size());
+    }
+    return ret;
+}
+
+bool RgdZstdOFStream::IsZstdPath(const std::string& file_path)
+{
+    const std::string extension(kZstdFileExtension);
+    return file_path.size() > extension.size() &&
+        file_path.compare(file_path.size() - extension.size(), extension.size(), extension) == 0;
+}
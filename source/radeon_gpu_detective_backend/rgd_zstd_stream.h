@@ -0,0 +1,85 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  zstd-compressed file output stream.
+//=============================================================================
+#ifndef RADEON_GPU_DETECTIVE_SOURCE_RGD_ZSTD_STREAM_H_
+#define RADEON_GPU_DETECTIVE_SOURCE_RGD_ZSTD_STREAM_H_
+
+// C++.
+#include <fstream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Zstd (vendored through RDF).
+#include <zstd.h>
+
+// Stream buffer compressing everything written through it with zstd before it
+// reaches the file. Input is compressed in fixed-size chunks as the buffer
+// fills up, so peak memory stays flat regardless of how much output flows
+// through the stream.
+class RgdZstdStreamBuf : public std::streambuf
+{
+public:
+    RgdZstdStreamBuf() = default;
+
+    // Finishes the zstd frame and closes the file if still open.
+    ~RgdZstdStreamBuf() override;
+
+    // Opens the output file and the compression context. Returns true on success.
+    bool Open(const std::string& file_path);
+
+    // Returns true while the file is open for writing.
+    bool IsOpen() const;
+
+    // Finishes the zstd frame and closes the file. Returns true on success.
+    bool Close();
+
+protected:
+    int overflow(int ch) override;
+    int sync() override;
+
+private:
+    // Compresses the pending put area contents and writes them to the file.
+    // When is_end_of_frame is set, the zstd frame is finished as well.
+    bool CompressPending(bool is_end_of_frame);
+
+    std::ofstream     file_stream_;
+    std::vector<char> in_buffer_;
+    std::vector<char> out_buffer_;
+    ZSTD_CCtx*        cctx_ = nullptr;
+};
+
+// An output stream writing a zstd-compressed file. Used transparently by the
+// output sinks when the user passes a .zst output path.
+class RgdZstdOFStream : public std::ostream
+{
+public:
+    RgdZstdOFStream() : std::ostream(&buf_) {}
+
+    // Opens the compressed output file.
+    explicit RgdZstdOFStream(const std::string& file_path) : std::ostream(&buf_) { Open(file_path); }
+
+    // Finishes the zstd frame and closes the file if still open.
+    ~RgdZstdOFStream() override = default;
+
+    // Opens the compressed output file. Returns true on success.
+    bool Open(const std::string& file_path) { return buf_.Open(file_path); }
+
+    // Returns true while the file is open for writing.
+    bool IsOpen() const { return buf_.IsOpen(); }
+
+    // Finishes the zstd frame and closes the file. Returns true on success.
+    bool Close() { return buf_.Close(); }
+
+    // Returns true when the given output path requests zstd compression.
+    static bool IsZstdPath(const std::string& file_path);
+
+private:
+    RgdZstdStreamBuf buf_;
+};
+
+#endif // RADEON_GPU_DETECTIVE_SOURCE_RGD_ZSTD_STREAM_H_
@@ -7,7 +7,11 @@
 
 // C++.
 #include <iostream>
+#include <atomic>
 #include <cassert>
+#include <filesystem>
+#include <future>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -16,8 +20,13 @@
 #include "rgd_data_types.h"
 #include "rgd_utils.h"
 #include "rgd_parsing_utils.h"
+#include "rgd_thread_pool.h"
+#include "rgd_mmap_file.h"
+#include "rgd_analysis_cache.h"
 #include "rgd_serializer.h"
 #include "rgd_serializer_json.h"
+#include "rgd_text_sink.h"
+#include "rgd_perf_stats.h"
 #include "rgd_resource_info_serializer.h"
 #include "rgd_version_info.h"
 #include "rgd_exec_marker_tree_serializer.h"
@@ -61,6 +70,14 @@ static bool IsInputValid(const Config& user_config)
             std::cerr << "ERROR: invalid output file path: " << user_config.output_file_txt << std::endl;
         }
     }
+    if (ret && !user_config.output_file_bin.empty())
+    {
+        ret = RgdUtils::IsValidFilePath(user_config.output_file_bin);
+        if (!ret)
+        {
+            std::cerr << "ERROR: invalid output file path: " << user_config.output_file_bin << std::endl;
+        }
+    }
     return ret;
 }
 
@@ -92,41 +109,115 @@ static void ParseApiInfoChunk(rdf::ChunkFile& chunk_file, TraceChunkApiInfo& api
     }
 }
 
-static bool ParseCrashDump(const Config& user_config, RgdCrashDumpContents& contents)
+// Creates an rdf stream over the crash dump. When the file is memory-mapped, the stream is a
+// zero-copy view over the mapping, so concurrent streams share one resident copy of the dump.
+static rdf::Stream OpenCrashDumpStream(const Config& user_config, const RgdMmapFile& crash_dump_mapping)
+{
+    if (crash_dump_mapping.IsMapped())
+    {
+        return rdf::Stream::FromReadOnlyMemory(crash_dump_mapping.GetSize(), crash_dump_mapping.GetData());
+    }
+    return rdf::Stream::OpenFile(user_config.crash_dump_file.c_str());
+}
+
+static bool ParseCrashDump(const Config& user_config, RgdCrashDumpContents& contents, RgdAnalysisCache& analysis_cache,
+    const RgdMmapFile& crash_dump_mapping)
 {
     std::cout << "Parsing crash dump file..." << std::endl;
 
-    // Read and parse the RDF file.
-    auto         file = rdf::Stream::OpenFile(user_config.crash_dump_file.c_str());
+    // When a matching analysis cache sidecar exists, the crash data events and the
+    // command buffer mapping are restored from it and only the lightweight chunks
+    // (system info, API info, process info and driver experiments) are re-parsed.
+    const bool is_cache_hit = analysis_cache.Load(user_config, contents);
 
     std::string error_msg;
     bool ret = false;
     bool is_system_info_parsed = false;
     bool is_driveroverrides_parsed = false;
-    try
-    {
-        rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
 
-        // Parse the UMD and KMD crash data chunk.
-        const char* kChunkCrashData = "DDEvent";
-        ret = RgdParsingUtils::ParseCrashDataChunks(chunk_file, kChunkCrashData, contents.umd_crash_data, contents.kmd_crash_data, error_msg);
+    // Number of independent chunk parsing tasks (DDEvent, SystemInfo, ApiInfo, TraceProcessInfo and DriverOverrides).
+    const size_t kParserTaskCount = 5;
+
+    // Parse the independent chunks concurrently. Each task opens its own stream over the crash
+    // dump file since rdf::ChunkFile reads share the underlying stream and interleaving them
+    // across threads is not safe. Each task writes into a distinct member of contents.
+    RgdThreadPool thread_pool(kParserTaskCount);
+    std::vector<std::future<void>> parse_tasks;
+    parse_tasks.reserve(kParserTaskCount);
 
+    if (!is_cache_hit)
+    {
+        parse_tasks.push_back(thread_pool.Submit([&]()
+        {
+            // Parse the UMD and KMD crash data chunk.
+            auto file = OpenCrashDumpStream(user_config, crash_dump_mapping);
+            rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
+            const char* kChunkCrashData = "DDEvent";
+
+            // Without --raw-data only the marker, crash debug NOP and page fault events are
+            // consumed, so timestamp tick events are skipped instead of materialized. With
+            // --max-memory the raw chunk payloads are compacted down to the retained
+            // records as soon as each chunk is decoded.
+            ret = RgdParsingUtils::ParseCrashDataChunks(chunk_file, kChunkCrashData, contents.umd_crash_data, contents.kmd_crash_data, error_msg,
+                user_config.is_raw_event_data, user_config.max_memory_mb > 0);
+            file.Close();
+        }));
+    }
+    else
+    {
+        // Crash data events were restored from the analysis cache.
+        ret = true;
+    }
+
+    parse_tasks.push_back(thread_pool.Submit([&]()
+    {
         // Parse System Info chunk.
+        auto file = OpenCrashDumpStream(user_config, crash_dump_mapping);
+        rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
         is_system_info_parsed = system_info_utils::SystemInfoReader::Parse(chunk_file, contents.system_info);
+        file.Close();
+    }));
 
+    parse_tasks.push_back(thread_pool.Submit([&]()
+    {
         // If ApiInfo chunk is available, parse chunk.
+        auto file = OpenCrashDumpStream(user_config, crash_dump_mapping);
+        rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
         ParseApiInfoChunk(chunk_file, contents.api_info, user_config.is_verbose);
+        file.Close();
+    }));
 
+    parse_tasks.push_back(thread_pool.Submit([&]()
+    {
         // Parse TraceProcessInfo chunk.
+        auto file = OpenCrashDumpStream(user_config, crash_dump_mapping);
+        rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
         RgdParsingUtils::ParseTraceProcessInfoChunk(chunk_file, kChunkIdTraceProcessInfo, contents.crashing_app_process_info);
+        file.Close();
+    }));
 
+    parse_tasks.push_back(thread_pool.Submit([&]()
+    {
+        // Parse DriverOverrides chunk.
+        auto file = OpenCrashDumpStream(user_config, crash_dump_mapping);
+        rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
         is_driveroverrides_parsed = RgdParsingUtils::ParseDriverOverridesChunk(chunk_file, kChunkIdDriverOverrides, contents.driver_experiments_json);
-    }
-    catch (const std::exception& e)
+        file.Close();
+    }));
+
+    // Wait for all the parsing tasks to complete and collect any failures.
+    for (std::future<void>& parse_task : parse_tasks)
     {
-        std::stringstream error_txt;
-        error_txt << " (" << e.what() << ")";
-        error_msg += error_txt.str();
+        try
+        {
+            parse_task.get();
+        }
+        catch (const std::exception& e)
+        {
+            std::stringstream error_txt;
+            error_txt << " (" << e.what() << ")";
+            error_msg += error_txt.str();
+        }
     }
 
     // This will hold the summary contents.
@@ -142,16 +233,19 @@ static bool ParseCrashDump(const Config& user_config, RgdCrashDumpContents& cont
     {
         RgdUtils::PrintMessage("crash data parsed successfully.", RgdMessageType::kInfo, user_config.is_verbose);
 
-        // Build the command buffer ID mapping.
-        ret = RgdParsingUtils::BuildCommandBufferMapping(user_config, contents.umd_crash_data, contents.cmd_buffer_mapping);
-        assert(ret);
-        if (ret)
+        if (!is_cache_hit || !analysis_cache.IsCmdBufferMappingLoaded())
         {
-            RgdUtils::PrintMessage("command buffer mapping built successfully.", RgdMessageType::kInfo, user_config.is_verbose);
-        }
-        else
-        {
-            RgdUtils::PrintMessage("failed to build command buffer mapping.", RgdMessageType::kError, user_config.is_verbose);
+            // Build the command buffer ID mapping.
+            ret = RgdParsingUtils::BuildCommandBufferMapping(user_config, contents.umd_crash_data, contents.cmd_buffer_mapping);
+            assert(ret);
+            if (ret)
+            {
+                RgdUtils::PrintMessage("command buffer mapping built successfully.", RgdMessageType::kInfo, user_config.is_verbose);
+            }
+            else
+            {
+                RgdUtils::PrintMessage("failed to build command buffer mapping.", RgdMessageType::kError, user_config.is_verbose);
+            }
         }
 
         assert(is_system_info_parsed);
@@ -174,9 +268,6 @@ static bool ParseCrashDump(const Config& user_config, RgdCrashDumpContents& cont
             std::cerr << "ERROR: failed to parse DriverOverrides chunk in crash dump file." << std::endl;
         }
 
-        // Done parsing the file here.
-        file.Close();
-
         if (is_system_info_parsed && ret)
         {
             std::cout << "Crash dump file parsed successfully." << std::endl;
@@ -190,10 +281,23 @@ static bool ParseCrashDump(const Config& user_config, RgdCrashDumpContents& cont
 }
 
 // Generate the text analysis output (to either file or console).
-static void SerializeTextOutput(const RgdCrashDumpContents& contents, const Config& user_config, RgdResourceInfoSerializer& resource_serializer)
+static void SerializeTextOutput(const RgdCrashDumpContents& contents, const Config& user_config, RgdResourceInfoSerializer& resource_serializer,
+    ExecMarkerDataSerializer& exec_marker_serializer)
 {
     bool is_ok = false;
-    std::stringstream txt;
+
+    // Stream each section of the report into the output file (or the console)
+    // as it is generated, instead of accumulating the entire report in one
+    // stringstream first. This bounds peak memory by the largest single
+    // section, which matters for --all-resources reports.
+    RgdTextSink text_sink(user_config.output_file_txt);
+    assert(text_sink.IsOpen());
+    if (!text_sink.IsOpen())
+    {
+        RgdUtils::PrintMessage("failed to open the text output file for writing.", RgdMessageType::kError, user_config.is_verbose);
+        return;
+    }
+    std::ostream& txt = text_sink.GetStream();
 
     std::string input_info_str;
     RgdSerializer::InputInfoToString(user_config, contents.crashing_app_process_info, contents.system_info, contents.api_info, input_info_str);
@@ -204,7 +308,6 @@ static void SerializeTextOutput(const RgdCrashDumpContents& contents, const Conf
     txt << system_info_str << std::endl;
 
     std::cout << "Generating text representation of the execution marker information..." << std::endl;
-    ExecMarkerDataSerializer exec_marker_serializer;
 
     RgdUtils::PrintMessage("generating text representation of the list of markers in progress...", RgdMessageType::kInfo, user_config.is_verbose);
     std::string exec_marker_summary;
@@ -235,45 +338,50 @@ static void SerializeTextOutput(const RgdCrashDumpContents& contents, const Conf
         RgdUtils::PrintMessage("failed to generate text representation of the list of markers in progress.", RgdMessageType::kError, user_config.is_verbose);
     }
 
-    RgdUtils::PrintMessage("generating text representation of the execution marker tree...", RgdMessageType::kInfo, user_config.is_verbose);
+    // In summary-only mode the marker summary above is the whole marker story:
+    // building and rendering the full execution marker tree is skipped.
+    if (!user_config.is_summary_only)
+    {
+        RgdUtils::PrintMessage("generating text representation of the execution marker tree...", RgdMessageType::kInfo, user_config.is_verbose);
 
-    // Generate the execution marker tree.
-    std::string exec_marker_tree;
-    is_ok = exec_marker_serializer.GenerateExecutionMarkerTree(user_config, contents.umd_crash_data,
-        contents.cmd_buffer_mapping, exec_marker_tree);
-    assert(is_ok);
-    txt << std::endl << std::endl;
-    txt << "=====================" << std::endl;
-    txt << "EXECUTION MARKER TREE" << std::endl;
-    txt << "=====================" << std::endl << std::endl;
+        // Generate the execution marker tree.
+        std::string exec_marker_tree;
+        is_ok = exec_marker_serializer.GenerateExecutionMarkerTree(user_config, contents.umd_crash_data,
+            contents.cmd_buffer_mapping, exec_marker_tree);
+        assert(is_ok);
+        txt << std::endl << std::endl;
+        txt << "=====================" << std::endl;
+        txt << "EXECUTION MARKER TREE" << std::endl;
+        txt << "=====================" << std::endl << std::endl;
 
-    bool is_empty_tree = (exec_marker_tree.find("INFO:") == 0);
-    if (is_ok)
-    {
-        if (!is_empty_tree)
+        bool is_empty_tree = (exec_marker_tree.find("INFO:") == 0);
+        if (is_ok)
         {
-            txt << "Legend" << std::endl;
-            txt << "======" << std::endl;
-            txt << "[X] finished" << std::endl;
-            txt << "[>] in progress" << std::endl;
-            txt << "[ ] not started" << std::endl << std::endl;
-
-            RgdUtils::PrintMessage("text representation of the execution marker tree generated successfully.",
-                RgdMessageType::kInfo, user_config.is_verbose);
+            if (!is_empty_tree)
+            {
+                txt << "Legend" << std::endl;
+                txt << "======" << std::endl;
+                txt << "[X] finished" << std::endl;
+                txt << "[>] in progress" << std::endl;
+                txt << "[ ] not started" << std::endl << std::endl;
+
+                RgdUtils::PrintMessage("text representation of the execution marker tree generated successfully.",
+                    RgdMessageType::kInfo, user_config.is_verbose);
+            }
+            else if (!user_config.is_verbose)
+            {
+                // In verbose mode, we would have already printed this message while trying to generate the marker summary.
+                RgdUtils::PrintMessage(kStrInfoNoCmdBuffersInFlight, RgdMessageType::kInfo, user_config.is_verbose);
+            }
         }
-        else if (!user_config.is_verbose)
+        else
         {
-            // In verbose mode, we would have already printed this message while trying to generate the marker summary.
-            RgdUtils::PrintMessage(kStrInfoNoCmdBuffersInFlight, RgdMessageType::kInfo, user_config.is_verbose);
+            RgdUtils::PrintMessage("failed to generate text representation of execution tree.", RgdMessageType::kError, user_config.is_verbose);
         }
-    }
-    else
-    {
-        RgdUtils::PrintMessage("failed to generate text representation of execution tree.", RgdMessageType::kError, user_config.is_verbose);
-    }
 
-    // Serialize the tree information or related messages into the output file.
-    txt << exec_marker_tree;
+        // Serialize the tree information or related messages into the output file.
+        txt << exec_marker_tree;
+    }
 
     if (user_config.is_raw_event_data)
     {
@@ -387,35 +495,140 @@ static void SerializeTextOutput(const RgdCrashDumpContents& contents, const Conf
 
     std::cout << "Page fault information analysis for the text representation completed." << std::endl;
 
-    // Write the output to a file if required, otherwise print to console.
+    // Keep the trailing newline that the whole-report file write used to append.
     if (!user_config.output_file_txt.empty())
     {
-        RgdUtils::WriteTextFile(user_config.output_file_txt, txt.str());
-    }
-    else
-    {
-        std::cout << txt.str();
+        txt << std::endl;
     }
+    text_sink.Flush();
 }
 
 static bool PerformCrashAnalysis(const Config& user_config)
 {
     RgdCrashDumpContents contents;
-    bool ret = ParseCrashDump(user_config, contents);
+    RgdAnalysisCache analysis_cache(user_config.crash_dump_file);
+
+    // Map the crash dump read-only. On failure (e.g. exotic file systems), fall
+    // back to regular buffered file streams. The mapping is kept alive for the
+    // whole analysis: the RMT trace loader below re-reads the dump through its
+    // own path-based API, and with the mapping resident that second pass is
+    // served from the page cache instead of going back to storage.
+    RgdMmapFile crash_dump_mapping;
+    if (!crash_dump_mapping.Map(user_config.crash_dump_file))
+    {
+        RgdUtils::PrintMessage("could not memory-map the crash dump file, falling back to buffered reads.",
+            RgdMessageType::kInfo, user_config.is_verbose);
+    }
+
+    bool ret = false;
+    {
+        RgdScopeTimer parse_timer("parse_crash_dump");
+        ret = ParseCrashDump(user_config, contents, analysis_cache, crash_dump_mapping);
+    }
+
+    if (ret && user_config.max_memory_mb > 0)
+    {
+        // The parsed chunk payloads were already compacted down to the retained event
+        // records. If the process is still over the budget, the dump simply carries
+        // more analysis-relevant data than the budget allows - report it and continue.
+        const uint64_t kCurrentRssBytes = RgdPerfStats::GetCurrentRssBytes();
+        if (kCurrentRssBytes > user_config.max_memory_mb * 1024 * 1024)
+        {
+            std::stringstream msg;
+            msg << "memory usage after parsing (" << RgdParsingUtils::GetFormattedSizeString(kCurrentRssBytes)
+                << ") exceeds the --max-memory budget of " << user_config.max_memory_mb << " MiB.";
+            RgdUtils::PrintMessage(msg.str().c_str(), RgdMessageType::kWarning, true);
+        }
+    }
 
     // True if the output we are required to produce is in text format (file or console).
-    bool is_text_required = !user_config.output_file_txt.empty() || user_config.output_file_json.empty();
-    bool is_json_required = !user_config.output_file_json.empty();
+    bool is_text_required = !user_config.output_file_txt.empty() ||
+        (user_config.output_file_json.empty() && user_config.output_file_bin.empty());
+
+    // The binary (MessagePack) output carries the same sections as the JSON output
+    // and is produced by the same serialization pass.
+    bool is_json_required = !user_config.output_file_json.empty() || !user_config.output_file_bin.empty();
+
+    // The RMT trace loader keeps a single global data set, so the resource analysis
+    // phase of concurrent batch jobs must not overlap. The parsing above runs
+    // outside the lock and overlaps freely across jobs.
+    static std::mutex rmt_trace_loader_mutex;
+    std::lock_guard<std::mutex> rmt_trace_loader_lock(rmt_trace_loader_mutex);
 
     RgdResourceInfoSerializer resource_serializer;
+    if (analysis_cache.HasVaIntervalIndex())
+    {
+        // Restore the interval index from the cache so that initializing the data
+        // set does not regenerate the full memory event history.
+        resource_serializer.SetVaIntervalIndex(std::move(analysis_cache.GetVaIntervalIndex()));
+    }
+
+    // The RMT data set load itself is deferred until the first page fault VA query
+    // needs it (the "rmt_trace_load" perf phase is recorded there when it happens).
     resource_serializer.InitializeWithTraceFile(user_config.crash_dump_file);
 
+    // When the analysis will query resource history (a page fault with a real VA,
+    // or --all-resources), start the RMT data set load on a worker now so that it
+    // overlaps the marker analysis below instead of stalling the first VA query.
+    // The query that reaches the serializer first simply blocks until the load is
+    // done; PreloadDataSet() makes the load race-safe.
+    bool is_va_query_expected = user_config.is_all_resources;
+    for (size_t i = 0, count = contents.kmd_crash_data.events.size(); !is_va_query_expected && ret && i < count; ++i)
+    {
+        const RgdEventOccurrence& current_event = contents.kmd_crash_data.events[i];
+        if (current_event.rgd_event != nullptr && current_event.rgd_event->header.eventId == uint8_t(KmdEventId::RgdEventVmPageFault))
+        {
+            const VmPageFaultEvent& page_fault_event = static_cast<const VmPageFaultEvent&>(*current_event.rgd_event);
+            is_va_query_expected = (page_fault_event.faultVmAddress != kVaReserved);
+        }
+    }
+
+    std::future<void> rmt_preload_task;
+    if (ret && is_va_query_expected)
+    {
+        rmt_preload_task = std::async(std::launch::async, [&resource_serializer]()
+        {
+            resource_serializer.PreloadDataSet();
+        });
+    }
+
+    // The marker analysis (per command buffer marker status and execution marker tree nodes)
+    // is computed once and shared by the text and JSON outputs.
+    ExecMarkerDataSerializer exec_marker_serializer;
+
+    // Writes the analysis cache sidecar on a worker so that it overlaps the
+    // remaining serialization pass. Launched after the first output pass, once
+    // the VA interval index is available to snapshot; a no-op when already
+    // launched or when the sidecar is up to date.
+    std::future<void> cache_save_task;
+    auto launch_cache_save = [&]()
+    {
+        if (ret && !analysis_cache.IsCacheHit() && !cache_save_task.valid())
+        {
+            std::vector<RgdVaInterval> va_intervals;
+            resource_serializer.GetVaIntervalIndex(va_intervals);
+            cache_save_task = std::async(std::launch::async,
+                [&analysis_cache, &user_config, &contents, intervals = std::move(va_intervals)]()
+            {
+                RgdScopeTimer cache_timer("analysis_cache_save");
+                analysis_cache.Save(user_config, contents, intervals);
+            });
+        }
+    };
+
     if (ret && is_text_required)
     {
-        SerializeTextOutput(contents, user_config, resource_serializer);
+        RgdScopeTimer text_timer("text_serialization");
+        SerializeTextOutput(contents, user_config, resource_serializer, exec_marker_serializer);
+
+        // The text pass ran every VA query, so the interval index (when one was
+        // built) is final: the sidecar write can overlap the JSON pass below.
+        launch_cache_save();
     }
     if (ret && is_json_required)
     {
+        RgdScopeTimer json_timer("json_serialization");
+
         // JSON.
         RgdSerializerJson serializer_json;
         serializer_json.SetInputInfo(user_config, contents.crashing_app_process_info, contents.system_info, contents.api_info);
@@ -423,14 +636,16 @@ static bool PerformCrashAnalysis(const Config& user_config)
         serializer_json.SetSystemInfoData(user_config, contents.system_info);
         serializer_json.SetDriverExperimentsInfoData(contents.driver_experiments_json);
 
-        ExecMarkerDataSerializer exec_marker_serializer;
-
         std::cout << "Generating JSON representation of the execution marker information..." << std::endl;
 
-        serializer_json.SetExecutionMarkerTree(user_config,
-            contents.umd_crash_data,
-            contents.cmd_buffer_mapping,
-            exec_marker_serializer);
+        // In summary-only mode the execution marker tree section is omitted.
+        if (!user_config.is_summary_only)
+        {
+            serializer_json.SetExecutionMarkerTree(user_config,
+                contents.umd_crash_data,
+                contents.cmd_buffer_mapping,
+                exec_marker_serializer);
+        }
 
         serializer_json.SetExecutionMarkerSummaryList(user_config,
             contents.umd_crash_data,
@@ -490,6 +705,123 @@ static bool PerformCrashAnalysis(const Config& user_config)
         serializer_json.SaveToFile(user_config);
     }
 
+    // Write the sidecar so that subsequent runs on this dump (e.g. with
+    // different flags) skip the parsing and history passes. In text-only or
+    // JSON-only runs this is the first chance to launch it.
+    launch_cache_save();
+
+    // Join the pipeline tasks before the serializers they reference go away.
+    if (rmt_preload_task.valid())
+    {
+        rmt_preload_task.get();
+    }
+    if (cache_save_task.valid())
+    {
+        cache_save_task.get();
+    }
+
+    if (user_config.is_perf_stats)
+    {
+        RgdPerfStats::PrintReport();
+    }
+
+    return ret;
+}
+
+// Returns the per-dump output path for batch mode: a file named after the input
+// dump with the given extension appended, placed in output_dir when one was
+// provided or beside the input file otherwise.
+static std::string GetBatchOutputPath(const std::string& output_dir, const std::filesystem::path& input_file, const char* extension)
+{
+    std::filesystem::path output_path = output_dir.empty() ? input_file.parent_path() : std::filesystem::path(output_dir);
+    output_path /= input_file.filename();
+    output_path += extension;
+    return output_path.string();
+}
+
+// Analyzes every crash dump in the input directory using a pool of workers,
+// producing one output pair per input file. Returns true when all jobs succeed.
+static bool PerformBatchCrashAnalysis(const Config& user_config)
+{
+    bool ret = false;
+
+    std::vector<std::filesystem::path> crash_dump_files;
+    std::error_code error_code;
+    for (const auto& directory_entry : std::filesystem::directory_iterator(user_config.parse_directory, error_code))
+    {
+        if (directory_entry.is_regular_file() && directory_entry.path().extension() == ".rgd")
+        {
+            crash_dump_files.push_back(directory_entry.path());
+        }
+    }
+
+    if (error_code)
+    {
+        std::stringstream err;
+        err << "could not read input directory " << user_config.parse_directory << " (" << error_code.message() << ")";
+        RgdUtils::PrintMessage(err.str().c_str(), RgdMessageType::kError, user_config.is_verbose);
+    }
+    else if (crash_dump_files.empty())
+    {
+        std::stringstream err;
+        err << "no .rgd crash dump files found in " << user_config.parse_directory;
+        RgdUtils::PrintMessage(err.str().c_str(), RgdMessageType::kError, user_config.is_verbose);
+    }
+    else
+    {
+        std::cout << "Analyzing " << crash_dump_files.size() << " crash dump files..." << std::endl;
+
+        // The workers pull jobs from the shared queue as they become idle, so the
+        // load balances itself across dumps of different sizes. The RMT loader is
+        // process-global, so the resource analysis phases are serialized inside
+        // PerformCrashAnalysis while parsing overlaps across jobs.
+        RgdThreadPool thread_pool;
+        std::vector<std::future<void>> analysis_jobs;
+        analysis_jobs.reserve(crash_dump_files.size());
+        std::atomic<size_t> failed_job_count = 0;
+
+        for (const std::filesystem::path& crash_dump_file : crash_dump_files)
+        {
+            analysis_jobs.push_back(thread_pool.Submit([&user_config, &failed_job_count, crash_dump_file]()
+            {
+                Config job_config = user_config;
+                job_config.parse_directory.clear();
+                job_config.crash_dump_file = crash_dump_file.string();
+                job_config.output_file_txt = GetBatchOutputPath(user_config.output_file_txt, crash_dump_file, ".txt");
+                job_config.output_file_json = user_config.output_file_json.empty()
+                    ? std::string()
+                    : GetBatchOutputPath(user_config.output_file_json, crash_dump_file, ".json");
+                job_config.output_file_bin = user_config.output_file_bin.empty()
+                    ? std::string()
+                    : GetBatchOutputPath(user_config.output_file_bin, crash_dump_file, ".bin");
+
+                if (!PerformCrashAnalysis(job_config))
+                {
+                    ++failed_job_count;
+                }
+            }));
+        }
+
+        for (std::future<void>& analysis_job : analysis_jobs)
+        {
+            try
+            {
+                analysis_job.get();
+            }
+            catch (const std::exception& e)
+            {
+                ++failed_job_count;
+                std::stringstream err;
+                err << "batch analysis job failed (" << e.what() << ")";
+                RgdUtils::PrintMessage(err.str().c_str(), RgdMessageType::kError, user_config.is_verbose);
+            }
+        }
+
+        ret = (failed_job_count == 0);
+        std::cout << "Batch analysis completed: " << (crash_dump_files.size() - failed_job_count)
+            << " of " << crash_dump_files.size() << " crash dump files analyzed successfully." << std::endl;
+    }
+
     return ret;
 }
 
@@ -510,8 +842,10 @@ int main(int argc, char* argv[])
             opts.add_options()
                 ("h,help", "Print help manual.")
                 ("p,parse", "Full path to input crash dump file to be parsed by rgd.", cxxopts::value<std::string>(user_config.crash_dump_file))
+                ("parse-dir", "Full path to a directory of crash dump (.rgd) files to be analyzed in a single batch. One output pair is written per input file, named after the input. When --output or --json are provided they are treated as output directories, otherwise outputs are written beside each input file.", cxxopts::value<std::string>(user_config.parse_directory))
                 ("o,output", "Full path to output text file to be generated by rgd with the analysis contents. If no output file path is provided (neither text or JSON), the tool will print the output to the console.", cxxopts::value<std::string>(user_config.output_file_txt))
                 ("j,json", "Full path to output JSON file to be generated by rgd with the analysis contents.", cxxopts::value<std::string>(user_config.output_file_json))
+                ("output-bin", "Full path to output binary file to be generated by rgd with the analysis contents encoded as MessagePack. Carries the same sections as the JSON output at a fraction of the encode/decode cost and file size, for machine consumption.", cxxopts::value<std::string>(user_config.output_file_bin))
                 ("v,version", "Print the rgd command line tool version.")
                 ("verbose", "If specified, the tool's console output will include more verbose low-level information such as task completion status. Error reposting may be more detailed as well.", cxxopts::value<bool>(user_config.is_verbose))
                 ("all-resources", "If specified, the tool's output will include all the resources regardless of their virtual address from the input crash dump file.", cxxopts::value<bool>(user_config.is_all_resources))
@@ -520,6 +854,9 @@ int main(int argc, char* argv[])
                 ("expand-markers", "If specified, all the marker nodes will be expanded in the execution marker tree visualization.", cxxopts::value<bool>(user_config.is_expand_markers))
                 ("compact-json", "If specified, print compact unindented JSON output. The default is pretty formatted JSON output.", cxxopts::value<bool>(user_config.is_compact_json))
                 ("internal-barriers", "If specified, include internal barriers in the execution marker tree.", cxxopts::value<bool>(user_config.is_include_internal_barriers))
+                ("perf-stats", "If specified, collect per-phase timing and memory statistics and print a machine-readable JSON breakdown at the end of the analysis.", cxxopts::value<bool>(user_config.is_perf_stats))
+                ("summary-only", "If specified, generate only the crash summary (markers in progress and page fault information) and skip the execution marker tree. Intended for automated triage, where this is considerably faster.", cxxopts::value<bool>(user_config.is_summary_only))
+                ("max-memory", "Memory budget in MiB for the analysis (0 means unlimited). When set, the raw crash data chunk payloads are released as soon as they are parsed, keeping only the event records the analysis consumes, and a warning is printed if the budget is still exceeded.", cxxopts::value<uint64_t>(user_config.max_memory_mb))
                 ;
 
             opts.add_options("internal")
@@ -542,9 +879,15 @@ int main(int argc, char* argv[])
                 exit(EXIT_SUCCESS);
             }
 
-            // Validate input.
-            ret = IsInputValid(user_config);
-            if (ret && RgdUtils::IsFileExists(user_config.crash_dump_file))
+            // Enable per-phase statistics collection before any analysis work starts.
+            RgdPerfStats::SetEnabled(user_config.is_perf_stats);
+
+            if (!user_config.parse_directory.empty())
+            {
+                // Batch mode: analyze every crash dump in the input directory.
+                ret = PerformBatchCrashAnalysis(user_config);
+            }
+            else if ((ret = IsInputValid(user_config)) == true && RgdUtils::IsFileExists(user_config.crash_dump_file))
             {
                 // Default: text or console.
                 ret = PerformCrashAnalysis(user_config);
@@ -0,0 +1,230 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  main entry point of RGD benchmark app.
+//=============================================================================
+
+// C++.
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// RGD backend.
+#include "rgd_data_types.h"
+#include "rgd_marker_data_serializer.h"
+#include "rgd_parsing_utils.h"
+#include "rgd_utils.h"
+
+// cxxopts.
+#include "cxxopts.hpp"
+
+// RDF.
+#include "rdf/rdf/inc/amdrdf.h"
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS - BEGIN ***
+
+// The crash data chunk identifier.
+static const char* kChunkIdCrashData = "DDEvent";
+
+// Default number of timed repetitions per benchmark.
+static const size_t kDefaultIterations = 5;
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS - ENDS ***
+
+// *** INTERNALLY-LINKED AUXILIARY FUNCTIONS - BEGIN ***
+
+// Runs the benchmark body once for warm-up and then the requested number of
+// timed repetitions, and reports the best repetition as ns/event. The best
+// (rather than the mean) is reported since it is the least noisy estimate of
+// the code's cost on an otherwise idle machine.
+static void RunBenchmark(const char* name, size_t event_count, size_t iterations, const std::function<void()>& body)
+{
+    assert(iterations > 0);
+
+    // Warm-up repetition: populates caches and triggers lazy allocations.
+    body();
+
+    int64_t best_ns = INT64_MAX;
+    for (size_t i = 0; i < iterations; i++)
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+        body();
+        const auto end_time = std::chrono::steady_clock::now();
+        const int64_t elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+        if (elapsed_ns < best_ns)
+        {
+            best_ns = elapsed_ns;
+        }
+    }
+
+    const double best_ms = best_ns / 1e6;
+    const double ns_per_event = (event_count > 0) ? (static_cast<double>(best_ns) / event_count) : 0.0;
+    std::cout << std::left << std::setw(36) << name
+              << " events: " << std::setw(10) << event_count
+              << " best: " << std::fixed << std::setprecision(3) << std::setw(12) << best_ms << " ms"
+              << " ns/event: " << std::setprecision(1) << ns_per_event << std::endl;
+}
+
+// Builds a synthetically amplified command buffer mapping by repeating each
+// command buffer's marker event index list the requested number of times.
+// Each repetition is a balanced begin/end sequence, so the amplified list is
+// still well-nested and exercises tree building and serialization at scale
+// without requiring large capture files.
+static void AmplifyCmdBufferMapping(const RgdCmdBufferMapping& cmd_buffer_mapping,
+                                    size_t amplification_factor,
+                                    RgdCmdBufferMapping& amplified_mapping)
+{
+    assert(amplification_factor > 0);
+    std::unordered_map<uint64_t, std::vector<size_t>> amplified_indices;
+    for (const RgdCmdBufferMapping::Range& cmd_buffer_range : cmd_buffer_mapping.GetRanges())
+    {
+        const RgdEventIndexSpan event_indices = cmd_buffer_mapping.GetSpan(cmd_buffer_range);
+        std::vector<size_t>& amplified_events = amplified_indices[cmd_buffer_range.cmd_buffer_id];
+        amplified_events.reserve(event_indices.size() * amplification_factor);
+        for (size_t i = 0; i < amplification_factor; i++)
+        {
+            amplified_events.insert(amplified_events.end(), event_indices.begin(), event_indices.end());
+        }
+    }
+    amplified_mapping.Build(amplified_indices);
+}
+
+// *** INTERNALLY-LINKED AUXILIARY FUNCTIONS - ENDS ***
+
+int main(int argc, char* argv[])
+{
+    std::string crash_dump_file;
+    size_t      iterations = kDefaultIterations;
+    size_t      amplify = 1;
+    bool        ret = false;
+
+    try
+    {
+        cxxopts::Options opts(argv[0]);
+        opts.add_options()
+            ("h,help", "Print help manual.")
+            ("rgd", "Full path to the input crash dump file used as the benchmark fixture.", cxxopts::value<std::string>(crash_dump_file))
+            ("iterations", "Number of timed repetitions per benchmark (default: 5).", cxxopts::value<size_t>(iterations))
+            ("amplify", "Synthetic amplification factor: repeats each command buffer's marker list this many times to benchmark tree building and serialization at scale (default: 1).", cxxopts::value<size_t>(amplify))
+            ;
+
+        auto result = opts.parse(argc, argv);
+        if (result.count("help"))
+        {
+            std::cout << opts.help({""}) << std::endl;
+            exit(EXIT_SUCCESS);
+        }
+
+        ret = !crash_dump_file.empty() && RgdUtils::IsFileExists(crash_dump_file) && iterations > 0 && amplify > 0;
+        if (!ret)
+        {
+            RgdUtils::PrintMessage("crash dump input file missing or invalid options. Use --rgd "
+                "<full path to crash dump file> (run -h for more details).", RgdMessageType::kError, true);
+        }
+    }
+    catch (const cxxopts::OptionException& e)
+    {
+        std::stringstream msg;
+        msg << "failed parsing options : " << e.what();
+        RgdUtils::PrintMessage(msg.str().c_str(), RgdMessageType::kError, true);
+        ret = false;
+    }
+
+    if (ret)
+    {
+        Config user_config;
+        user_config.crash_dump_file = crash_dump_file;
+
+        try
+        {
+            // Fixture: parse the crash dump once and build the command buffer mapping.
+            CrashData   umd_crash_data;
+            CrashData   kmd_crash_data;
+            std::string error_msg;
+            auto        file = rdf::Stream::OpenFile(crash_dump_file.c_str());
+            rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
+            ret = RgdParsingUtils::ParseCrashDataChunks(chunk_file, kChunkIdCrashData, umd_crash_data, kmd_crash_data, error_msg);
+            if (!ret)
+            {
+                RgdUtils::PrintMessage("could not parse the crash dump file.", RgdMessageType::kError, true);
+            }
+
+            RgdCmdBufferMapping cmd_buffer_mapping;
+            if (ret)
+            {
+                ret = RgdParsingUtils::BuildCommandBufferMapping(user_config, umd_crash_data, cmd_buffer_mapping);
+            }
+
+            if (ret)
+            {
+                RgdCmdBufferMapping amplified_mapping;
+                AmplifyCmdBufferMapping(cmd_buffer_mapping, amplify, amplified_mapping);
+
+                size_t marker_event_count = 0;
+                for (const RgdCmdBufferMapping::Range& cmd_buffer_range : amplified_mapping.GetRanges())
+                {
+                    marker_event_count += cmd_buffer_range.count;
+                }
+
+                std::cout << "Input file: " << crash_dump_file << std::endl;
+                std::cout << "Amplification factor: " << amplify << std::endl << std::endl;
+
+                const size_t parsed_event_count = umd_crash_data.events.size() + kmd_crash_data.events.size();
+                RunBenchmark("parse_crash_data_chunks", parsed_event_count, iterations, [&]()
+                {
+                    CrashData   bench_umd_crash_data;
+                    CrashData   bench_kmd_crash_data;
+                    std::string bench_error_msg;
+                    auto        bench_file = rdf::Stream::OpenFile(crash_dump_file.c_str());
+                    rdf::ChunkFile bench_chunk_file = rdf::ChunkFile(bench_file);
+                    RgdParsingUtils::ParseCrashDataChunks(bench_chunk_file, kChunkIdCrashData, bench_umd_crash_data, bench_kmd_crash_data, bench_error_msg);
+                });
+
+                RunBenchmark("build_cmd_buffer_mapping", umd_crash_data.events.size(), iterations, [&]()
+                {
+                    RgdCmdBufferMapping bench_mapping;
+                    RgdParsingUtils::BuildCommandBufferMapping(user_config, umd_crash_data, bench_mapping);
+                });
+
+                RunBenchmark("marker_tree_build_and_text", marker_event_count, iterations, [&]()
+                {
+                    // A fresh serializer per repetition: tree building is lazy and cached,
+                    // so reusing one instance would only measure the first repetition.
+                    ExecMarkerDataSerializer serializer;
+                    std::string              summary_txt;
+                    std::string              tree_txt;
+                    serializer.GenerateExecutionMarkerSummaryList(user_config, umd_crash_data, amplified_mapping, summary_txt);
+                    serializer.GenerateExecutionMarkerTree(user_config, umd_crash_data, amplified_mapping, tree_txt);
+                });
+
+                RunBenchmark("marker_tree_build_and_json", marker_event_count, iterations, [&]()
+                {
+                    ExecMarkerDataSerializer serializer;
+                    nlohmann::json           summary_json;
+                    nlohmann::json           tree_json;
+                    serializer.GenerateExecutionMarkerSummaryListJson(user_config, umd_crash_data, amplified_mapping, summary_json);
+                    serializer.GenerateExecutionMarkerTreeToJson(user_config, umd_crash_data, amplified_mapping, tree_json);
+                    const std::string dumped = tree_json.dump();
+                    (void)dumped;
+                });
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::stringstream error_txt;
+            error_txt << "could not run the benchmarks (" << e.what() << ")";
+            RgdUtils::PrintMessage(error_txt.str().c_str(), RgdMessageType::kError, true);
+            ret = false;
+        }
+    }
+
+    return ret ? 0 : -1;
+}
@@ -0,0 +1,213 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  synthetic crash dump generator for tests.
+//=============================================================================
+
+#include "rgd_test_dump_generator.h"
+
+// C++.
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+// RDF.
+#include "rdf/rdf/inc/amdrdf.h"
+
+// Dev driver.
+#include "dev_driver/include/rgdevents.h"
+
+// RGD backend.
+#include "rgd_utils.h"
+
+// *** INTERNALLY-LINKED CONSTANTS AND FUNCTIONS - BEGIN ***
+
+// The crash data chunk identifier.
+static const char* kChunkIdCrashData = "DDEvent";
+
+// Provider IDs as emitted by the driver (must match the values validated by
+// RgdParsingUtils::ParseCrashDataChunks).
+static const uint32_t kProviderIdUmd = 0x50434145;
+static const uint32_t kProviderIdKmd = 0xE43C9C8E;
+
+// First synthetic command buffer ID; subsequent command buffers increment it.
+static const uint32_t kFirstCmdBufferId = 0x100;
+
+// Appends byte_count raw bytes to the payload buffer.
+static void AppendBytes(std::vector<uint8_t>& payload, const void* bytes, size_t byte_count)
+{
+    const uint8_t* begin = static_cast<const uint8_t*>(bytes);
+    payload.insert(payload.end(), begin, begin + byte_count);
+}
+
+// Appends a DDEventHeader with the given event id and record body size.
+static void AppendEventHeader(std::vector<uint8_t>& payload, uint8_t event_id, uint16_t event_size)
+{
+    DDEventHeader header;
+    header.eventId = event_id;
+    header.delta = 1;
+    header.eventSize = event_size;
+    AppendBytes(payload, &header, sizeof(header));
+}
+
+// Appends a timestamp tick event advancing the event clock by delta_ticks.
+static void AppendTimestampEvent(std::vector<uint8_t>& payload, uint64_t delta_ticks)
+{
+    DDEventHeader header;
+    header.eventId = DDCommonEventId::RgdEventTimestamp;
+    header.delta = 0;
+    header.eventSize = sizeof(uint64_t);
+    AppendBytes(payload, &header, sizeof(header));
+    AppendBytes(payload, &delta_ticks, sizeof(delta_ticks));
+}
+
+// Appends an execution marker begin event. The marker name is written
+// truncated to its actual length, as the driver does.
+static void AppendMarkerBeginEvent(std::vector<uint8_t>& payload, uint32_t cmd_buffer_id, uint32_t marker_value, const std::string& marker_name)
+{
+    const uint16_t marker_string_size = static_cast<uint16_t>(marker_name.size());
+    const uint16_t event_size = static_cast<uint16_t>(sizeof(cmd_buffer_id) + sizeof(marker_value) + sizeof(marker_string_size) + marker_string_size);
+    AppendEventHeader(payload, static_cast<uint8_t>(UmdEventId::RgdEventExecutionMarkerBegin), event_size);
+    AppendBytes(payload, &cmd_buffer_id, sizeof(cmd_buffer_id));
+    AppendBytes(payload, &marker_value, sizeof(marker_value));
+    AppendBytes(payload, &marker_string_size, sizeof(marker_string_size));
+    AppendBytes(payload, marker_name.data(), marker_string_size);
+}
+
+// Appends an execution marker end event.
+static void AppendMarkerEndEvent(std::vector<uint8_t>& payload, uint32_t cmd_buffer_id, uint32_t marker_value)
+{
+    const uint16_t event_size = static_cast<uint16_t>(sizeof(cmd_buffer_id) + sizeof(marker_value));
+    AppendEventHeader(payload, static_cast<uint8_t>(UmdEventId::RgdEventExecutionMarkerEnd), event_size);
+    AppendBytes(payload, &cmd_buffer_id, sizeof(cmd_buffer_id));
+    AppendBytes(payload, &marker_value, sizeof(marker_value));
+}
+
+// Appends a crash debug NOP event carrying the last begun and last finished
+// marker timestamp values read back from the crash debug buffer.
+static void AppendCrashDebugNopEvent(std::vector<uint8_t>& payload, uint32_t cmd_buffer_id, uint32_t begin_timestamp_value, uint32_t end_timestamp_value)
+{
+    const uint16_t event_size = static_cast<uint16_t>(sizeof(CrashDebugNopData) - sizeof(DDEventHeader));
+    AppendEventHeader(payload, static_cast<uint8_t>(UmdEventId::RgdEventCrashDebugNopData), event_size);
+    AppendBytes(payload, &cmd_buffer_id, sizeof(cmd_buffer_id));
+    AppendBytes(payload, &begin_timestamp_value, sizeof(begin_timestamp_value));
+    AppendBytes(payload, &end_timestamp_value, sizeof(end_timestamp_value));
+}
+
+// Appends a page fault event for the given faulting virtual address.
+static void AppendPageFaultEvent(std::vector<uint8_t>& payload, uint64_t fault_va)
+{
+    VmPageFaultEvent page_fault_event{};
+    const char* kProcessName = "synthetic_app.exe";
+    page_fault_event.header.eventId = static_cast<uint8_t>(KmdEventId::RgdEventVmPageFault);
+    page_fault_event.header.delta = 1;
+    page_fault_event.header.eventSize = static_cast<uint16_t>(sizeof(VmPageFaultEvent) - sizeof(DDEventHeader));
+    page_fault_event.vmId = 1;
+    page_fault_event.processId = 1234;
+    page_fault_event.faultVmAddress = fault_va;
+    page_fault_event.processNameLength = static_cast<uint16_t>(strlen(kProcessName));
+    memcpy(page_fault_event.processName, kProcessName, strlen(kProcessName));
+    AppendBytes(payload, &page_fault_event, sizeof(page_fault_event));
+}
+
+// Returns a DDEventProviderHeader for the given provider.
+static DDEventProviderHeader MakeProviderHeader(uint32_t provider_id)
+{
+    DDEventProviderHeader provider_header{};
+    provider_header.metaVersionMajor = static_cast<uint16_t>(DDEventMetaVersionMajor);
+    provider_header.metaVersionMinor = static_cast<uint16_t>(DDEventMetaVersionMinor);
+    provider_header.reserved = 0;
+    provider_header.providerId = provider_id;
+    provider_header.timeUnit = 1;
+    provider_header.baseTimestamp = 1000;
+    provider_header.baseTimestampFrequency = 100000000;
+    return provider_header;
+}
+
+// Starts an event chunk payload with the meta version and provider header that
+// ParseCrashDataChunks expects at the front of every DDEvent chunk payload.
+static void BeginChunkPayload(std::vector<uint8_t>& payload, const DDEventProviderHeader& provider_header)
+{
+    DDEventMetaVersion meta_version{};
+    meta_version.major = static_cast<uint16_t>(DDEventMetaVersionMajor);
+    meta_version.minor = static_cast<uint16_t>(DDEventMetaVersionMinor);
+    AppendBytes(payload, &meta_version, sizeof(meta_version));
+    AppendBytes(payload, &provider_header, sizeof(provider_header));
+}
+
+// *** INTERNALLY-LINKED CONSTANTS AND FUNCTIONS - END ***
+
+bool RgdTestDumpGenerator::WriteSyntheticCrashDump(const std::string& file_path, const RgdSyntheticDumpConfig& config)
+{
+    bool ret = false;
+
+    // UMD event chunk: per command buffer, timestamp ticks followed by a crash
+    // debug NOP event and the marker begin/end events.
+    const DDEventProviderHeader umd_provider_header = MakeProviderHeader(kProviderIdUmd);
+    std::vector<uint8_t> umd_payload;
+    BeginChunkPayload(umd_payload, umd_provider_header);
+
+    for (size_t cmd_buffer_index = 0; cmd_buffer_index < config.cmd_buffer_count; cmd_buffer_index++)
+    {
+        const uint32_t cmd_buffer_id = static_cast<uint32_t>(kFirstCmdBufferId + cmd_buffer_index);
+
+        for (size_t t = 0; t < config.timestamp_events_per_cmd_buffer; t++)
+        {
+            AppendTimestampEvent(umd_payload, 10);
+        }
+
+        // Marker values are per command buffer: "Frame" is 1, the draws are
+        // 2..draws_per_cmd_buffer+1. The crash debug NOP event reports the last
+        // draw as the last to begin and the second-to-last draw as the last to
+        // end, so the last draw of every command buffer is in progress and all
+        // earlier draws are finished.
+        const uint32_t kFrameMarkerValue = 1;
+        const uint32_t kLastDrawMarkerValue = static_cast<uint32_t>(config.draws_per_cmd_buffer + 1);
+        AppendCrashDebugNopEvent(umd_payload, cmd_buffer_id, kLastDrawMarkerValue, kLastDrawMarkerValue - 1);
+
+        AppendMarkerBeginEvent(umd_payload, cmd_buffer_id, kFrameMarkerValue, "Frame");
+        for (size_t draw_index = 0; draw_index < config.draws_per_cmd_buffer; draw_index++)
+        {
+            std::stringstream draw_name;
+            draw_name << "Draw " << draw_index;
+            const uint32_t draw_marker_value = static_cast<uint32_t>(draw_index + 2);
+            AppendMarkerBeginEvent(umd_payload, cmd_buffer_id, draw_marker_value, draw_name.str());
+            AppendMarkerEndEvent(umd_payload, cmd_buffer_id, draw_marker_value);
+        }
+        AppendMarkerEndEvent(umd_payload, cmd_buffer_id, kFrameMarkerValue);
+    }
+
+    // KMD event chunk: a timestamp tick and the page fault event.
+    const DDEventProviderHeader kmd_provider_header = MakeProviderHeader(kProviderIdKmd);
+    std::vector<uint8_t> kmd_payload;
+    if (config.is_include_page_fault)
+    {
+        BeginChunkPayload(kmd_payload, kmd_provider_header);
+        AppendTimestampEvent(kmd_payload, 10);
+        AppendPageFaultEvent(kmd_payload, config.fault_va);
+    }
+
+    try
+    {
+        auto stream = rdf::Stream::CreateFile(file_path.c_str());
+        rdf::ChunkFileWriter writer(stream);
+        writer.WriteChunk(kChunkIdCrashData, sizeof(umd_provider_header), &umd_provider_header,
+            static_cast<int64_t>(umd_payload.size()), umd_payload.data());
+        if (config.is_include_page_fault)
+        {
+            writer.WriteChunk(kChunkIdCrashData, sizeof(kmd_provider_header), &kmd_provider_header,
+                static_cast<int64_t>(kmd_payload.size()), kmd_payload.data());
+        }
+        writer.Close();
+        ret = true;
+    }
+    catch (const std::exception& e)
+    {
+        std::stringstream error_txt;
+        error_txt << "could not write the synthetic crash dump file (" << e.what() << ").";
+        RgdUtils::PrintMessage(error_txt.str().c_str(), RgdMessageType::kError, true);
+    }
+
+    return ret;
+}
@@ -0,0 +1,57 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  synthetic crash dump generator for tests.
+//=============================================================================
+#ifndef RGD_TEST_RGD_TEST_DUMP_GENERATOR_H_
+#define RGD_TEST_RGD_TEST_DUMP_GENERATOR_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// Parameters of a synthetic crash dump. The generated event stream models a
+// crash while the last draw of each command buffer was executing: every command
+// buffer carries a crash debug NOP event followed by a "Frame" marker with
+// draws_per_cmd_buffer "Draw <n>" begin/end pairs nested under it. The crash
+// debug NOP timestamp values mark the last draw as in progress and every
+// earlier draw as finished.
+struct RgdSyntheticDumpConfig
+{
+    // Number of command buffers emitted into the UMD event stream. Command
+    // buffer IDs start at 0x100.
+    size_t cmd_buffer_count = 1;
+
+    // Number of "Draw <n>" begin/end marker pairs under each command buffer's
+    // "Frame" marker. Must be at least 2 so that the generated crash point has
+    // both finished and in-progress draws.
+    size_t draws_per_cmd_buffer = 2;
+
+    // Number of timestamp tick events emitted before each command buffer's
+    // markers. Timestamp ticks dominate real capture streams, so scaling this
+    // parameter exercises the timestamp fast paths of the parser.
+    size_t timestamp_events_per_cmd_buffer = 4;
+
+    // When true, a KMD event chunk with a single page fault event is emitted.
+    bool is_include_page_fault = true;
+
+    // Faulting virtual address reported by the page fault event.
+    uint64_t fault_va = 0xdeadb000ull;
+};
+
+// Writes valid RDF crash dump files with parameterized event counts, so that
+// tests can exercise parsing, mapping and serialization at arbitrary scales
+// without requiring large capture files.
+class RgdTestDumpGenerator
+{
+public:
+    // Writes a synthetic crash dump to the given path. Returns true on success.
+    static bool WriteSyntheticCrashDump(const std::string& file_path, const RgdSyntheticDumpConfig& config);
+
+private:
+    RgdTestDumpGenerator() = delete;
+    ~RgdTestDumpGenerator() = delete;
+};
+
+#endif // RGD_TEST_RGD_TEST_DUMP_GENERATOR_H_
@@ -0,0 +1,372 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  tests for the backend I/O paths: analysis cache sidecar, zstd
+///         output stream and streaming JSON writer.
+//=============================================================================
+
+// C++.
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+// catch2.
+#include <catch.hpp>
+
+// Local.
+#include "rgd_test_dump_generator.h"
+
+// RGD backend.
+#include "rgd_analysis_cache.h"
+#include "rgd_data_types.h"
+#include "rgd_marker_data_serializer.h"
+#include "rgd_parsing_utils.h"
+#include "rgd_streaming_json_writer.h"
+#include "rgd_zstd_stream.h"
+
+// RDF.
+#include "rdf/rdf/inc/amdrdf.h"
+
+// Zstd (vendored through RDF).
+#include <zstd.h>
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS AND FUNCTIONS - BEGIN ***
+
+// The crash data chunk identifier.
+static const char* kChunkIdCrashData = "DDEvent";
+
+// Extension of the analysis cache sidecar file, appended to the crash dump file name.
+static const char* kCacheFileExtension = ".rgdcache";
+
+// Returns a full path for a transient test file with the given name.
+static std::string GetTempFilePath(const char* file_name)
+{
+    return (std::filesystem::temp_directory_path() / file_name).string();
+}
+
+// Deletes the transient test file, ignoring a file that was never created.
+static void RemoveTempFile(const std::string& file_path)
+{
+    std::error_code error_code;
+    std::filesystem::remove(file_path, error_code);
+}
+
+// Reads the whole file into a byte buffer. Returns true on success.
+static bool ReadFileBytes(const std::string& file_path, std::vector<uint8_t>& bytes)
+{
+    std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+    bool ret = file.is_open();
+    if (ret)
+    {
+        bytes.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        file.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+        ret = file.good();
+    }
+    return ret;
+}
+
+// Overwrites the file with the given byte buffer. Returns true on success.
+static bool WriteFileBytes(const std::string& file_path, const std::vector<uint8_t>& bytes)
+{
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    bool ret = file.is_open();
+    if (ret)
+    {
+        file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        ret = file.good();
+    }
+    return ret;
+}
+
+// Generates a synthetic dump at the given path and parses it into contents,
+// including the command buffer mapping. Returns true on success.
+static bool GenerateAndParseDump(const std::string& dump_path, const Config& user_config, RgdCrashDumpContents& contents)
+{
+    RgdSyntheticDumpConfig dump_config;
+    dump_config.cmd_buffer_count = 2;
+    dump_config.draws_per_cmd_buffer = 3;
+    bool ret = RgdTestDumpGenerator::WriteSyntheticCrashDump(dump_path, dump_config);
+    if (ret)
+    {
+        std::string error_msg;
+        auto file = rdf::Stream::OpenFile(dump_path.c_str());
+        rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
+        ret = RgdParsingUtils::ParseCrashDataChunks(chunk_file, kChunkIdCrashData, contents.umd_crash_data, contents.kmd_crash_data, error_msg, user_config.is_raw_event_data);
+    }
+    if (ret)
+    {
+        ret = RgdParsingUtils::BuildCommandBufferMapping(user_config, contents.umd_crash_data, contents.cmd_buffer_mapping);
+    }
+    return ret;
+}
+
+// Returns true when both crash data structures hold the same events: equal
+// counts and per-event matching event IDs, sizes and timestamps.
+static bool AreCrashDataEventsEqual(const CrashData& reference_data, const CrashData& loaded_data)
+{
+    bool ret = reference_data.events.size() == loaded_data.events.size();
+    for (size_t i = 0; ret && i < reference_data.events.size(); i++)
+    {
+        const RgdEventOccurrence& reference_event = reference_data.events[i];
+        const RgdEventOccurrence& loaded_event = loaded_data.events[i];
+        ret = reference_event.event_time == loaded_event.event_time
+            && reference_event.rgd_event->header.eventId == loaded_event.rgd_event->header.eventId
+            && reference_event.rgd_event->header.eventSize == loaded_event.rgd_event->header.eventSize;
+    }
+    return ret;
+}
+
+// Loads the sidecar bytes, lets the test mutate them, writes them back and
+// verifies that a fresh cache treats the sidecar as a miss without crashing.
+static void RequireCorruptedSidecarIsMiss(const std::string& dump_path, const Config& user_config, const std::function<void(std::vector<uint8_t>&)>& corrupt)
+{
+    const std::string cache_path = dump_path + kCacheFileExtension;
+    std::vector<uint8_t> sidecar_bytes;
+    REQUIRE(ReadFileBytes(cache_path, sidecar_bytes));
+    corrupt(sidecar_bytes);
+    REQUIRE(WriteFileBytes(cache_path, sidecar_bytes));
+
+    RgdAnalysisCache corrupted_cache(dump_path);
+    RgdCrashDumpContents loaded_contents;
+    REQUIRE(!corrupted_cache.Load(user_config, loaded_contents));
+
+    // The fallback leaves the contents in the pristine "parse from scratch" state.
+    REQUIRE(loaded_contents.umd_crash_data.events.empty());
+    REQUIRE(loaded_contents.cmd_buffer_mapping.IsEmpty());
+}
+
+// Decompresses a complete zstd file (streamed frame, unknown content size in
+// the frame header) into the output string. Returns true on success.
+static bool DecompressZstdFile(const std::string& file_path, std::string& decompressed)
+{
+    std::vector<uint8_t> compressed_bytes;
+    bool ret = ReadFileBytes(file_path, compressed_bytes);
+    if (ret)
+    {
+        ZSTD_DCtx* dctx = ZSTD_createDCtx();
+        ret = dctx != nullptr;
+        if (ret)
+        {
+            std::vector<char> out_buffer(ZSTD_DStreamOutSize());
+            ZSTD_inBuffer input{ compressed_bytes.data(), compressed_bytes.size(), 0 };
+            while (ret && input.pos < input.size)
+            {
+                ZSTD_outBuffer output{ out_buffer.data(), out_buffer.size(), 0 };
+                const size_t status = ZSTD_decompressStream(dctx, &output, &input);
+                ret = !ZSTD_isError(status);
+                decompressed.append(out_buffer.data(), output.pos);
+            }
+            ZSTD_freeDCtx(dctx);
+        }
+    }
+    return ret;
+}
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS AND FUNCTIONS - ENDS ***
+
+TEST_CASE("AnalysisCacheRoundTrip", "[TestAnalysisCache]")
+{
+    const std::string dump_path = GetTempFilePath("rgd_test_cache_round_trip.rgd");
+    const std::string cache_path = dump_path + kCacheFileExtension;
+    Config user_config;
+    user_config.crash_dump_file = dump_path;
+
+    RgdCrashDumpContents contents;
+    REQUIRE(GenerateAndParseDump(dump_path, user_config, contents));
+
+    // First run: a miss (no sidecar yet) that hashes the dump, then a save.
+    RgdAnalysisCache cache(dump_path);
+    REQUIRE(!cache.Load(user_config, contents));
+    REQUIRE(cache.Save(user_config, contents, {}));
+
+    // Second run: the sidecar restores the events and the command buffer mapping.
+    RgdAnalysisCache second_run_cache(dump_path);
+    RgdCrashDumpContents loaded_contents;
+    REQUIRE(second_run_cache.Load(user_config, loaded_contents));
+    REQUIRE(second_run_cache.IsCacheHit());
+    REQUIRE(second_run_cache.IsCmdBufferMappingLoaded());
+
+    // The event pointers are rebuilt from stored payload offsets into the
+    // reloaded payload; compare the events through those pointers.
+    REQUIRE(AreCrashDataEventsEqual(contents.umd_crash_data, loaded_contents.umd_crash_data));
+    REQUIRE(AreCrashDataEventsEqual(contents.kmd_crash_data, loaded_contents.kmd_crash_data));
+
+    // The command buffer mapping round-trips range for range.
+    REQUIRE(loaded_contents.cmd_buffer_mapping.GetCmdBufferCount() == contents.cmd_buffer_mapping.GetCmdBufferCount());
+    for (const RgdCmdBufferMapping::Range& reference_range : contents.cmd_buffer_mapping.GetRanges())
+    {
+        const RgdCmdBufferMapping::Range* loaded_range = loaded_contents.cmd_buffer_mapping.FindRange(reference_range.cmd_buffer_id);
+        REQUIRE(loaded_range != nullptr);
+        REQUIRE(loaded_range->count == reference_range.count);
+        const RgdEventIndexSpan reference_indices = contents.cmd_buffer_mapping.GetSpan(reference_range);
+        const RgdEventIndexSpan loaded_indices = loaded_contents.cmd_buffer_mapping.GetSpan(*loaded_range);
+        for (size_t i = 0; i < reference_indices.size(); i++)
+        {
+            REQUIRE(loaded_indices[i] == reference_indices[i]);
+        }
+    }
+
+    // A mapping built from the loaded events must match the cached one.
+    RgdCmdBufferMapping rebuilt_mapping;
+    REQUIRE(RgdParsingUtils::BuildCommandBufferMapping(user_config, loaded_contents.umd_crash_data, rebuilt_mapping));
+    REQUIRE(rebuilt_mapping.GetCmdBufferCount() == loaded_contents.cmd_buffer_mapping.GetCmdBufferCount());
+
+    RemoveTempFile(cache_path);
+    RemoveTempFile(dump_path);
+}
+
+TEST_CASE("AnalysisCacheRejectsCorruptSidecar", "[TestAnalysisCache]")
+{
+    const std::string dump_path = GetTempFilePath("rgd_test_cache_corrupt.rgd");
+    const std::string cache_path = dump_path + kCacheFileExtension;
+    Config user_config;
+    user_config.crash_dump_file = dump_path;
+
+    RgdCrashDumpContents contents;
+    REQUIRE(GenerateAndParseDump(dump_path, user_config, contents));
+
+    RgdAnalysisCache cache(dump_path);
+    REQUIRE(!cache.Load(user_config, contents));
+    REQUIRE(cache.Save(user_config, contents, {}));
+
+    // Each section re-runs the setup above, so every corruption below starts
+    // from a freshly written, valid sidecar.
+    SECTION("Corrupted magic bytes")
+    {
+        RequireCorruptedSidecarIsMiss(dump_path, user_config, [](std::vector<uint8_t>& bytes)
+        {
+            bytes[0] ^= 0xFF;
+        });
+    }
+
+    SECTION("Truncated sidecar")
+    {
+        RequireCorruptedSidecarIsMiss(dump_path, user_config, [](std::vector<uint8_t>& bytes)
+        {
+            bytes.resize(bytes.size() / 2);
+        });
+    }
+
+    SECTION("Oversized payload size field")
+    {
+        // The UMD payload size field sits right after the fixed file header
+        // (8-byte magic, two uint32 fields and two uint64 fields), the UMD chunk
+        // header and the time info. An absurd value must be rejected by the
+        // bounds checks instead of driving the pointer fixups out of the payload.
+        const size_t kFileHeaderSize = 8 + 2 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+        const size_t kPayloadSizeOffset = kFileHeaderSize + sizeof(DDEventProviderHeader) + sizeof(CrashAnalysisTimeInfo);
+        RequireCorruptedSidecarIsMiss(dump_path, user_config, [kPayloadSizeOffset](std::vector<uint8_t>& bytes)
+        {
+            REQUIRE(bytes.size() > kPayloadSizeOffset + sizeof(uint64_t));
+            for (size_t i = 0; i < sizeof(uint64_t); i++)
+            {
+                bytes[kPayloadSizeOffset + i] = 0xFF;
+            }
+        });
+    }
+
+    SECTION("Stale sidecar after the dump changed")
+    {
+        // Append a byte to the dump: the recorded hash and size no longer match.
+        std::vector<uint8_t> dump_bytes;
+        REQUIRE(ReadFileBytes(dump_path, dump_bytes));
+        dump_bytes.push_back(0);
+        REQUIRE(WriteFileBytes(dump_path, dump_bytes));
+
+        RgdAnalysisCache stale_cache(dump_path);
+        RgdCrashDumpContents loaded_contents;
+        REQUIRE(!stale_cache.Load(user_config, loaded_contents));
+    }
+
+    RemoveTempFile(cache_path);
+    RemoveTempFile(dump_path);
+}
+
+TEST_CASE("ZstdStreamRoundTrip", "[TestZstdStream]")
+{
+    const std::string compressed_path = GetTempFilePath("rgd_test_zstd_round_trip.txt.zst");
+    REQUIRE(RgdZstdOFStream::IsZstdPath(compressed_path));
+
+    // A patterned payload larger than the stream's internal chunk size, so the
+    // round trip covers multiple compress-and-flush cycles within one frame.
+    std::string original;
+    original.reserve(2 * 1024 * 1024);
+    for (size_t line = 0; original.size() < 2 * 1024 * 1024; line++)
+    {
+        original += "marker line ";
+        original += std::to_string(line);
+        original += ": some repetitive crash analysis output text.\n";
+    }
+
+    RgdZstdOFStream compressed_stream;
+    REQUIRE(compressed_stream.Open(compressed_path));
+    REQUIRE(compressed_stream.IsOpen());
+    compressed_stream << original;
+    REQUIRE(compressed_stream.Close());
+
+    // The file must be a valid zstd frame that decompresses byte-identically.
+    std::string decompressed;
+    REQUIRE(DecompressZstdFile(compressed_path, decompressed));
+    REQUIRE(decompressed == original);
+
+    RemoveTempFile(compressed_path);
+}
+
+TEST_CASE("StreamingJsonMatchesDomAndMessagePack", "[TestStreamingJson]")
+{
+    const std::string dump_path = GetTempFilePath("rgd_test_streaming_json.rgd");
+    const std::string json_path = GetTempFilePath("rgd_test_streaming_json.json");
+    Config user_config;
+    user_config.crash_dump_file = dump_path;
+    user_config.output_file_json = json_path;
+
+    RgdCrashDumpContents contents;
+    REQUIRE(GenerateAndParseDump(dump_path, user_config, contents));
+
+    // The DOM document: marker summary and tree sections built in memory.
+    ExecMarkerDataSerializer serializer;
+    nlohmann::json summary_json;
+    nlohmann::json tree_json;
+    REQUIRE(serializer.GenerateExecutionMarkerSummaryListJson(user_config, contents.umd_crash_data, contents.cmd_buffer_mapping, summary_json));
+    REQUIRE(serializer.GenerateExecutionMarkerTreeToJson(user_config, contents.umd_crash_data, contents.cmd_buffer_mapping, tree_json));
+
+    nlohmann::json dom_document;
+    dom_document[kJsonElemMarkersInProgress] = summary_json[kJsonElemMarkersInProgress];
+    dom_document[kJsonElemExecutionMarkerTree] = tree_json[kJsonElemExecutionMarkerTree];
+
+    // The streaming writer must produce an equivalent document section by
+    // section, in both the 4-space-indented and the compact format.
+    const bool compact_modes[] = { false, true };
+    for (const bool is_compact : compact_modes)
+    {
+        user_config.is_compact_json = is_compact;
+
+        RgdStreamingJsonWriter streaming_writer;
+        REQUIRE(streaming_writer.Open(user_config));
+        streaming_writer.WriteSection(kJsonElemMarkersInProgress, dom_document[kJsonElemMarkersInProgress]);
+        for (const nlohmann::json& tree_element : dom_document[kJsonElemExecutionMarkerTree])
+        {
+            streaming_writer.AppendArrayElement(kJsonElemExecutionMarkerTree, tree_element);
+        }
+        REQUIRE(streaming_writer.Close());
+
+        std::ifstream streamed_file(json_path);
+        REQUIRE(streamed_file.is_open());
+        const nlohmann::json streamed_document = nlohmann::json::parse(streamed_file, nullptr, false);
+        REQUIRE(!streamed_document.is_discarded());
+        REQUIRE(streamed_document == dom_document);
+    }
+
+    // The MessagePack representation of the same document round-trips losslessly.
+    const std::vector<uint8_t> msgpack_data = nlohmann::json::to_msgpack(dom_document);
+    const nlohmann::json msgpack_document = nlohmann::json::from_msgpack(msgpack_data);
+    REQUIRE(msgpack_document == dom_document);
+
+    RemoveTempFile(json_path);
+    RemoveTempFile(dump_path);
+}
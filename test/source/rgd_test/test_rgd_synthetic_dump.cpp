@@ -0,0 +1,256 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  tests running the backend against generated synthetic crash dumps.
+//=============================================================================
+
+// C++.
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#include <string>
+
+// catch2.
+#include <catch.hpp>
+
+// Local.
+#include "rgd_test_dump_generator.h"
+
+// RGD backend.
+#include "rgd_data_types.h"
+#include "rgd_marker_data_serializer.h"
+#include "rgd_parsing_utils.h"
+
+// RDF.
+#include "rdf/rdf/inc/amdrdf.h"
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS AND FUNCTIONS - BEGIN ***
+
+// The crash data chunk identifier.
+static const char* kChunkIdCrashData = "DDEvent";
+
+// First synthetic command buffer ID emitted by the generator.
+static const uint64_t kFirstSyntheticCmdBufferId = 0x100;
+
+// Returns a full path for a transient test file with the given name.
+static std::string GetTempFilePath(const char* file_name)
+{
+    return (std::filesystem::temp_directory_path() / file_name).string();
+}
+
+// Deletes the transient test file, ignoring a file that was never created.
+static void RemoveTempFile(const std::string& file_path)
+{
+    std::error_code error_code;
+    std::filesystem::remove(file_path, error_code);
+}
+
+// Parses the synthetic crash dump at the given path into the UMD and KMD crash data.
+static bool ParseSyntheticDump(const std::string& file_path, CrashData& umd_crash_data, CrashData& kmd_crash_data, bool is_all_events_required = false)
+{
+    std::string error_msg;
+    auto file = rdf::Stream::OpenFile(file_path.c_str());
+    rdf::ChunkFile chunk_file = rdf::ChunkFile(file);
+    return RgdParsingUtils::ParseCrashDataChunks(chunk_file, kChunkIdCrashData, umd_crash_data, kmd_crash_data, error_msg, is_all_events_required);
+}
+
+// Returns the number of marker events the command buffer mapping is expected to
+// hold per command buffer: one "Frame" begin/end pair plus one begin/end pair per draw.
+static size_t ExpectedMarkerEventsPerCmdBuffer(const RgdSyntheticDumpConfig& dump_config)
+{
+    return 2 + 2 * dump_config.draws_per_cmd_buffer;
+}
+
+// Measures a single analysis phase and asserts it stayed within its budget. The
+// budgets are deliberately generous - they are regression tripwires for
+// order-of-magnitude slowdowns, not micro-benchmarks (rgd_bench covers those).
+static void RequirePhaseWithinBudget(const char* phase_name, int64_t budget_ms, const std::function<void()>& phase)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+    phase();
+    const auto end_time = std::chrono::steady_clock::now();
+    const int64_t elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count();
+    INFO("phase \"" << phase_name << "\" took " << elapsed_ms << " ms (budget: " << budget_ms << " ms)");
+    CHECK(elapsed_ms <= budget_ms);
+}
+
+// *** INTERNALLY-LINKED AUXILIARY CONSTANTS AND FUNCTIONS - ENDS ***
+
+TEST_CASE("SyntheticDumpParsing", "[TestSyntheticDump]")
+{
+    const std::string dump_path = GetTempFilePath("rgd_test_synthetic_parse.rgd");
+    RgdSyntheticDumpConfig dump_config;
+    dump_config.cmd_buffer_count = 3;
+    dump_config.draws_per_cmd_buffer = 4;
+    REQUIRE(RgdTestDumpGenerator::WriteSyntheticCrashDump(dump_path, dump_config));
+
+    CrashData umd_crash_data;
+    CrashData kmd_crash_data;
+    REQUIRE(ParseSyntheticDump(dump_path, umd_crash_data, kmd_crash_data));
+
+    SECTION("Parsed event counts")
+    {
+        // Per command buffer: one crash debug NOP event plus the marker begin/end
+        // events. Timestamp ticks are not materialized by default.
+        const size_t kExpectedUmdEvents = dump_config.cmd_buffer_count * (1 + ExpectedMarkerEventsPerCmdBuffer(dump_config));
+        REQUIRE(umd_crash_data.events.size() == kExpectedUmdEvents);
+
+        // The KMD stream carries the page fault event; its timestamp tick is skipped.
+        REQUIRE(kmd_crash_data.events.size() == 1);
+        const RgdEventOccurrence& page_fault_occurrence = kmd_crash_data.events[0];
+        REQUIRE(static_cast<KmdEventId>(page_fault_occurrence.rgd_event->header.eventId) == KmdEventId::RgdEventVmPageFault);
+        const VmPageFaultEvent& page_fault_event = static_cast<const VmPageFaultEvent&>(*page_fault_occurrence.rgd_event);
+        REQUIRE(page_fault_event.faultVmAddress == dump_config.fault_va);
+    }
+
+    SECTION("Timestamp events materialized on demand")
+    {
+        CrashData umd_with_timestamps;
+        CrashData kmd_with_timestamps;
+        REQUIRE(ParseSyntheticDump(dump_path, umd_with_timestamps, kmd_with_timestamps, true));
+        const size_t kExpectedTimestampEvents = dump_config.cmd_buffer_count * dump_config.timestamp_events_per_cmd_buffer;
+        REQUIRE(umd_with_timestamps.events.size() == umd_crash_data.events.size() + kExpectedTimestampEvents);
+        REQUIRE(kmd_with_timestamps.events.size() == kmd_crash_data.events.size() + 1);
+    }
+
+    SECTION("Command buffer mapping")
+    {
+        Config user_config;
+        RgdCmdBufferMapping cmd_buffer_mapping;
+        REQUIRE(RgdParsingUtils::BuildCommandBufferMapping(user_config, umd_crash_data, cmd_buffer_mapping));
+        REQUIRE(cmd_buffer_mapping.GetCmdBufferCount() == dump_config.cmd_buffer_count);
+
+        for (size_t i = 0; i < dump_config.cmd_buffer_count; i++)
+        {
+            const uint64_t cmd_buffer_id = kFirstSyntheticCmdBufferId + i;
+            const RgdCmdBufferMapping::Range* cmd_buffer_range = cmd_buffer_mapping.FindRange(cmd_buffer_id);
+            REQUIRE(cmd_buffer_range != nullptr);
+            REQUIRE(cmd_buffer_range->cmd_buffer_id == cmd_buffer_id);
+            REQUIRE(cmd_buffer_range->count == ExpectedMarkerEventsPerCmdBuffer(dump_config));
+
+            // Every index points at a marker event of this command buffer, in timestamp order.
+            const RgdEventIndexSpan event_indices = cmd_buffer_mapping.GetSpan(*cmd_buffer_range);
+            uint64_t previous_event_time = 0;
+            for (const size_t event_index : event_indices)
+            {
+                REQUIRE(event_index < umd_crash_data.events.size());
+                const RgdEventOccurrence& marker_event = umd_crash_data.events[event_index];
+                REQUIRE(marker_event.event_time >= previous_event_time);
+                previous_event_time = marker_event.event_time;
+            }
+        }
+
+        // A command buffer ID that was never emitted has no range.
+        REQUIRE(cmd_buffer_mapping.FindRange(kFirstSyntheticCmdBufferId + dump_config.cmd_buffer_count) == nullptr);
+    }
+
+    RemoveTempFile(dump_path);
+}
+
+TEST_CASE("SyntheticDumpGoldenMarkerText", "[TestSyntheticDump]")
+{
+    // The golden strings below pin the exact console rendering of the marker tree
+    // and the summary list for the generator's crash scenario: "Draw 0" finished
+    // and "Draw 1" (the crash point) in progress under an in-progress "Frame".
+    const std::string dump_path = GetTempFilePath("rgd_test_synthetic_golden.rgd");
+    RgdSyntheticDumpConfig dump_config;
+    dump_config.cmd_buffer_count = 1;
+    dump_config.draws_per_cmd_buffer = 2;
+    REQUIRE(RgdTestDumpGenerator::WriteSyntheticCrashDump(dump_path, dump_config));
+
+    CrashData umd_crash_data;
+    CrashData kmd_crash_data;
+    REQUIRE(ParseSyntheticDump(dump_path, umd_crash_data, kmd_crash_data));
+
+    Config user_config;
+    RgdCmdBufferMapping cmd_buffer_mapping;
+    REQUIRE(RgdParsingUtils::BuildCommandBufferMapping(user_config, umd_crash_data, cmd_buffer_mapping));
+
+    ExecMarkerDataSerializer serializer;
+
+    SECTION("Execution marker tree")
+    {
+        const std::string kGoldenTree =
+            "Command Buffer ID: 0x100\n"
+            "========================\n"
+            "[>] \"Frame\"\n"
+            " |--[X] \"Draw 0\"\n"
+            " '--[>] \"Draw 1\"\n"
+            "\n";
+        std::string marker_tree;
+        REQUIRE(serializer.GenerateExecutionMarkerTree(user_config, umd_crash_data, cmd_buffer_mapping, marker_tree));
+        REQUIRE(marker_tree == kGoldenTree);
+    }
+
+    SECTION("Marker summary list")
+    {
+        const std::string kGoldenSummary =
+            "Command Buffer ID: 0x100\n"
+            "========================\n"
+            "Frame/Draw 1\n"
+            "\n";
+        std::string marker_summary;
+        REQUIRE(serializer.GenerateExecutionMarkerSummaryList(user_config, umd_crash_data, cmd_buffer_mapping, marker_summary));
+        REQUIRE(marker_summary == kGoldenSummary);
+    }
+
+    RemoveTempFile(dump_path);
+}
+
+TEST_CASE("SyntheticDumpPhaseBudgets", "[TestSyntheticDump][performance]")
+{
+    // A dump large enough that an order-of-magnitude regression in any phase
+    // blows its budget, while a healthy build completes each phase in a small
+    // fraction of it.
+    const std::string dump_path = GetTempFilePath("rgd_test_synthetic_budget.rgd");
+    RgdSyntheticDumpConfig dump_config;
+    dump_config.cmd_buffer_count = 64;
+    dump_config.draws_per_cmd_buffer = 512;
+    dump_config.timestamp_events_per_cmd_buffer = 4096;
+    REQUIRE(RgdTestDumpGenerator::WriteSyntheticCrashDump(dump_path, dump_config));
+
+    CrashData umd_crash_data;
+    CrashData kmd_crash_data;
+    RequirePhaseWithinBudget("parse_crash_data_chunks", 10000, [&]()
+    {
+        REQUIRE(ParseSyntheticDump(dump_path, umd_crash_data, kmd_crash_data));
+    });
+    const size_t kExpectedUmdEvents = dump_config.cmd_buffer_count * (1 + ExpectedMarkerEventsPerCmdBuffer(dump_config));
+    REQUIRE(umd_crash_data.events.size() == kExpectedUmdEvents);
+
+    Config user_config;
+    RgdCmdBufferMapping cmd_buffer_mapping;
+    RequirePhaseWithinBudget("build_cmd_buffer_mapping", 5000, [&]()
+    {
+        REQUIRE(RgdParsingUtils::BuildCommandBufferMapping(user_config, umd_crash_data, cmd_buffer_mapping));
+    });
+    REQUIRE(cmd_buffer_mapping.GetCmdBufferCount() == dump_config.cmd_buffer_count);
+
+    ExecMarkerDataSerializer text_serializer;
+    std::string marker_summary;
+    std::string marker_tree;
+    RequirePhaseWithinBudget("marker_tree_build_and_text", 15000, [&]()
+    {
+        REQUIRE(text_serializer.GenerateExecutionMarkerSummaryList(user_config, umd_crash_data, cmd_buffer_mapping, marker_summary));
+        REQUIRE(text_serializer.GenerateExecutionMarkerTree(user_config, umd_crash_data, cmd_buffer_mapping, marker_tree));
+    });
+    REQUIRE(!marker_tree.empty());
+
+    // A fresh serializer: the tree build is lazy and cached, so reusing the text
+    // serializer would let the JSON phase ride on the text phase's tree.
+    ExecMarkerDataSerializer json_serializer;
+    nlohmann::json summary_json;
+    nlohmann::json tree_json;
+    RequirePhaseWithinBudget("marker_tree_build_and_json", 15000, [&]()
+    {
+        REQUIRE(json_serializer.GenerateExecutionMarkerSummaryListJson(user_config, umd_crash_data, cmd_buffer_mapping, summary_json));
+        REQUIRE(json_serializer.GenerateExecutionMarkerTreeToJson(user_config, umd_crash_data, cmd_buffer_mapping, tree_json));
+        const std::string dumped = tree_json.dump();
+        REQUIRE(!dumped.empty());
+    });
+
+    RemoveTempFile(dump_path);
+}